@@ -533,6 +533,128 @@ extern void * eo_deque_At(EOdeque * deque, eOsizecntnr_t pos)
     return((void*) item);         
 }
 
+
+extern eOsizecntnr_t eo_deque_PushBackMany(EOdeque * deque, const void *items, eOsizecntnr_t number) 
+{
+    // here we require uint8_t to access stored_items because we work with bytes.
+    uint8_t *start = NULL;
+    const uint8_t *p = (const uint8_t*) items;
+    eOsizecntnr_t n = 0;
+    eOsizecntnr_t chunk = 0;
+    eOsizecntnr_t pos = 0;
+    eOsizecntnr_t i = 0;
+        
+    if((NULL == deque) || (NULL == items)) 
+    {   // invalid data
+        return(0);    
+    }
+    
+    n = deque->capacity - deque->size;
+    if(number < n)
+    {
+        n = number;
+    }
+    
+    if(0 == n) 
+    {   // deque is full or nothing to copy
+        return(0);
+    }
+       
+    start = (uint8_t*) (deque->stored_items);
+    
+    if(NULL == deque->item_copy_fn)
+    {   // plain bytes: one memcpy() up to the end of the ring and another one from its start
+        chunk = deque->capacity - deque->next;
+        if(chunk > n)
+        {
+            chunk = n;
+        }
+        // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
+        memcpy(&start[(uint32_t)deque->next * deque->item_size], p, (uint32_t)chunk * deque->item_size);
+        memcpy(start, &p[(uint32_t)chunk * deque->item_size], (uint32_t)(n - chunk) * deque->item_size);
+    }
+    else
+    {
+        pos = deque->next;
+        for(i=0; i<n; i++)
+        {
+            deque->item_copy_fn(&start[(uint32_t)pos * deque->item_size], (void*)&p[(uint32_t)i * deque->item_size]);
+            pos = (pos + 1) % (deque->capacity);
+        }
+    }
+    
+    deque->next = (uint32_t)(deque->next + n) % (deque->capacity);
+    deque->size += n;
+    
+    return(n); 
+}
+
+
+extern eOsizecntnr_t eo_deque_PopFrontMany(EOdeque * deque, void *items, eOsizecntnr_t number) 
+{
+    // here we require uint8_t to access stored_items because we work with bytes.
+    uint8_t *start = NULL;
+    uint8_t *p = (uint8_t*) items;
+    uint8_t *item = NULL;
+    eOsizecntnr_t n = 0;
+    eOsizecntnr_t chunk = 0;
+    eOsizecntnr_t pos = 0;
+    eOsizecntnr_t i = 0;
+        
+    if(NULL == deque) 
+    {   // invalid deque
+        return(0);    
+    }
+    
+    n = (number < deque->size) ? (number) : (deque->size);
+    
+    if(0 == n) 
+    {   // deque is empty or nothing to remove
+        return(0);
+    }
+    
+    start = (uint8_t*) (deque->stored_items);
+    
+    if((NULL != p) && (NULL == deque->item_copy_fn))
+    {   // plain bytes: one memcpy() up to the end of the ring and another one from its start
+        chunk = deque->capacity - deque->first;
+        if(chunk > n)
+        {
+            chunk = n;
+        }
+        // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
+        memcpy(p, &start[(uint32_t)deque->first * deque->item_size], (uint32_t)chunk * deque->item_size);
+        memcpy(&p[(uint32_t)chunk * deque->item_size], start, (uint32_t)(n - chunk) * deque->item_size);
+    }
+    
+    pos = deque->first;
+    for(i=0; i<n; i++)
+    {
+        item = &start[(uint32_t)pos * deque->item_size];
+        
+        if((NULL != p) && (NULL != deque->item_copy_fn))
+        {
+            deque->item_copy_fn(&p[(uint32_t)i * deque->item_size], item);
+        }
+        
+        if(NULL != deque->item_clear_fn) 
+        {   // destroy
+            deque->item_clear_fn(item);
+        } 
+        else 
+        {   // default clear
+            s_eo_deque_default_clear(item, deque);
+        }
+        
+        pos = (pos + 1) % (deque->capacity);
+    }
+    
+    deque->first = pos;
+    deque->size -= n;
+    
+    return(n); 
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
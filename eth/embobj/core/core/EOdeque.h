@@ -150,6 +150,18 @@ extern eObool_t eo_deque_Full(EOdeque * deque);
 extern void eo_deque_PushBack(EOdeque * deque, void *p);
 
 
+/** @fn         extern eOsizecntnr_t eo_deque_PushBackMany(EOdeque * deque, const void *items, eOsizecntnr_t number)
+    @brief      Copies up to @e number contiguous item objects at the back of the EOdeque, stopping when it is full.
+                If no @e item_copy was passed in eo_deque_New() the copy is done with at most two memcpy(),
+                one for each side of the wrap point of the internal ring.
+    @param      deque           Pointer to the EOdeque object.
+    @param      items           Pointer to an array of item objects.
+    @param      number          Number of item objects in @e items.
+    @return     The number of item objects which have been copied.
+ **/
+extern eOsizecntnr_t eo_deque_PushBackMany(EOdeque * deque, const void *items, eOsizecntnr_t number);
+
+
 /** @fn         extern void eo_deque_PushFront(EOdeque *deque, void *p)
     @brief      Copies item object pointed by @e p at the front of the EOdeque and calls its constructor
                 @e item_ctor(p) if passed not NULL in eo_deque_New().
@@ -186,6 +198,19 @@ extern void* eo_deque_Back(EOdeque * deque);
 extern void eo_deque_PopFront(EOdeque * deque); 
 
 
+/** @fn         extern eOsizecntnr_t eo_deque_PopFrontMany(EOdeque * deque, void *items, eOsizecntnr_t number)
+    @brief      Removes up to @e number item objects from the front of the EOdeque. If @e items is not NULL 
+                the removed item objects are first copied into it, with at most two memcpy() if no 
+                @e item_copy was passed in eo_deque_New(). Each removed item object is then destroyed as
+                in eo_deque_PopFront().
+    @param      deque           Pointer to the EOdeque object.
+    @param      items           Pointer to an array which receives the item objects, or NULL.
+    @param      number          Max number of item objects to remove.
+    @return     The number of item objects which have been removed.
+ **/
+extern eOsizecntnr_t eo_deque_PopFrontMany(EOdeque * deque, void *items, eOsizecntnr_t number);
+
+
 /** @fn         extern void eo_deque_PopBack(EOdeque * deque)
     @brief      Removes the item object from the back of the EOdeque, calls its destructor
                 @e item_dtor(p) if passed not NULL in eo_deque_new(), and finally sets memory to zero.
@@ -67,7 +67,26 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+EO_static_inline void s_eo_fifo_spsc_barrier(void)
+{
+#if defined(EO_atomic_barrier)
+    EO_atomic_barrier();
+#endif
+}
+
+EO_static_inline uint8_t * s_eo_fifo_slot(EOfifo *fifo, eOsizecntnr_t index)
+{
+    // cast to uint32_t to tell the reader that index of array can be bigger than max eOsizecntnr_t
+    return((uint8_t*)fifo->dek->stored_items + (uint32_t)index*fifo->dek->item_size);
+}
+
+static eOsizecntnr_t s_eo_fifo_spsc_size(EOfifo *fifo);
+static void * s_eo_fifo_spsc_front(EOfifo *fifo);
+static eOsizecntnr_t s_eo_fifo_spsc_put(EOfifo *fifo, const uint8_t *items, eOsizecntnr_t number);
+static eOsizecntnr_t s_eo_fifo_spsc_getrem(EOfifo *fifo, uint8_t *items, eOsizecntnr_t number);
+static eOsizecntnr_t s_eo_fifo_dek_put(EOfifo *fifo, const uint8_t *items, eOsizecntnr_t number);
+static eOsizecntnr_t s_eo_fifo_dek_getrem(EOfifo *fifo, uint8_t *items, eOsizecntnr_t number);
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -100,11 +119,37 @@ extern EOfifo * eo_fifo_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
 
     // now i copy the passed mutex into mutexfifo. beware for future use, ... it may be NULL
     retptr->mutex = mutex;
+    
+    retptr->spsc        = eobool_false;
+    retptr->spscread    = 0;
+    retptr->spscwrite   = 0;
  
     // ok, done
     return(retptr);
 }
 
+
+extern EOfifo * eo_fifo_NewSPSC(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                eOres_fp_voidp_uint32_t item_init, uint32_t init_arg, 
+                                eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear) 
+{
+    EOfifo *retptr = NULL; 
+    
+#if !defined(EO_atomic_barrier)
+    eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_fifo_NewSPSC(): no memory barrier on this platform", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+#endif
+
+    eo_errman_Assert(eo_errman_GetHandle(), (0 != capacity), "eo_fifo_NewSPSC(): 0 capacity", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (capacity < EOK_uint16dummy), "eo_fifo_NewSPSC(): capacity too big", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    
+    // one item more, which is always empty, so that a full fifo has spscread different from spscwrite
+    retptr = eo_fifo_New(item_size, capacity+1, item_init, init_arg, item_copy, item_clear, NULL);
+    
+    retptr->spsc = eobool_true;
+    
+    return(retptr);
+}
+
 extern void eo_fifo_Delete(EOfifo * fifo)
 {
     if(NULL == fifo) 
@@ -150,6 +195,12 @@ extern eOresult_t eo_fifo_Capacity(EOfifo *fifo, eOsizecntnr_t *capacity, eOrelt
         return(eores_NOK_nullpointer);
     }
     
+    if(eobool_true == fifo->spsc)
+    {
+        *capacity = eo_deque_Capacity(fifo->dek) - 1;
+        return(eores_OK);
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -188,6 +239,12 @@ extern eOresult_t eo_fifo_Size(EOfifo *fifo, eOsizecntnr_t *size, eOreltime_t to
         return(eores_NOK_nullpointer);
     }
     
+    if(eobool_true == fifo->spsc)
+    {
+        *size = s_eo_fifo_spsc_size(fifo);
+        return(eores_OK);
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -225,6 +282,11 @@ extern eOresult_t eo_fifo_Put(EOfifo *fifo, void *pitem, eOreltime_t tout)
         return(eores_NOK_nullpointer);
     }
     
+    if(eobool_true == fifo->spsc)
+    {
+        return((1 == s_eo_fifo_spsc_put(fifo, (const uint8_t*)pitem, 1)) ? (eores_OK) : (eores_NOK_busy));
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -282,6 +344,12 @@ extern eOresult_t eo_fifo_Get(EOfifo *fifo, const void **ppitem, eOreltime_t tou
         return(eores_NOK_nullpointer);
     }
     
+    if(eobool_true == fifo->spsc)
+    {
+        *ppitem = s_eo_fifo_spsc_front(fifo);
+        return((NULL != *ppitem) ? (eores_OK) : (eores_NOK_nodata));
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -333,6 +401,12 @@ extern eOresult_t eo_fifo_Rem(EOfifo *fifo, eOreltime_t tout) {
         return(eores_NOK_nullpointer);
     }
     
+    if(eobool_true == fifo->spsc)
+    {
+        s_eo_fifo_spsc_getrem(fifo, NULL, 1);
+        return(eores_OK);
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -371,6 +445,11 @@ extern eOresult_t eo_fifo_GetRem(EOfifo *fifo, void *pitem, eOreltime_t tout)
         return(eores_NOK_nullpointer);
     }
     
+    if(eobool_true == fifo->spsc)
+    {
+        return((1 == s_eo_fifo_spsc_getrem(fifo, (uint8_t*)pitem, 1)) ? (eores_OK) : (eores_NOK_nodata));
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -449,6 +528,12 @@ extern eOresult_t eo_fifo_Clear(EOfifo *fifo, eOreltime_t tout)
         return(eores_NOK_nullpointer);
     }
     
+    if(eobool_true == fifo->spsc)
+    {
+        s_eo_fifo_spsc_getrem(fifo, NULL, eo_deque_Capacity(fifo->dek));
+        return(eores_OK);
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -476,6 +561,90 @@ extern eOresult_t eo_fifo_Clear(EOfifo *fifo, eOreltime_t tout)
 }
 
 
+extern eOresult_t eo_fifo_PutMany(EOfifo *fifo, const void *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout)
+{
+    eOsizecntnr_t n = 0;
+    
+    if(NULL != put)
+    {
+        *put = 0;
+    }
+    
+    if((NULL == fifo) || (NULL == items)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(eobool_true == fifo->spsc)
+    {
+        n = s_eo_fifo_spsc_put(fifo, (const uint8_t*)items, number);
+    }
+    else if(NULL == fifo->mutex)
+    {
+        n = s_eo_fifo_dek_put(fifo, (const uint8_t*)items, number);
+    }
+    else if(eores_OK == eov_mutex_Take(fifo->mutex, tout)) 
+    {
+        n = s_eo_fifo_dek_put(fifo, (const uint8_t*)items, number);
+        eov_mutex_Release(fifo->mutex);
+    }
+    else
+    {
+        // unfortunately we did not get the mutex for timeout
+        return(eores_NOK_timeout);
+    }
+    
+    if(NULL != put)
+    {
+        *put = n;
+    }
+    
+    return((number == n) ? (eores_OK) : (eores_NOK_busy));
+}
+
+
+extern eOresult_t eo_fifo_GetRemMany(EOfifo *fifo, void *items, eOsizecntnr_t capacity, eOsizecntnr_t *got, eOreltime_t tout)
+{
+    eOsizecntnr_t n = 0;
+    
+    if(NULL != got)
+    {
+        *got = 0;
+    }
+    
+    if((NULL == fifo) || (NULL == items)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(eobool_true == fifo->spsc)
+    {
+        n = s_eo_fifo_spsc_getrem(fifo, (uint8_t*)items, capacity);
+    }
+    else if(NULL == fifo->mutex)
+    {
+        n = s_eo_fifo_dek_getrem(fifo, (uint8_t*)items, capacity);
+    }
+    else if(eores_OK == eov_mutex_Take(fifo->mutex, tout)) 
+    {
+        n = s_eo_fifo_dek_getrem(fifo, (uint8_t*)items, capacity);
+        eov_mutex_Release(fifo->mutex);
+    }
+    else
+    {
+        // unfortunately we did not get the mutex for timeout
+        return(eores_NOK_timeout);
+    }
+    
+    if(NULL != got)
+    {
+        *got = n;
+    }
+    
+    return((0 != n) ? (eores_OK) : (eores_NOK_nodata));
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -485,7 +654,144 @@ extern eOresult_t eo_fifo_Clear(EOfifo *fifo, eOreltime_t tout)
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// in spsc mode the deque has one item more than the fifo. spscwrite is changed only by the producer and spscread only by 
+// the consumer. each of them first reads both indices and then issues a barrier before touching the items, and after 
+// having used the items issues another barrier before publishing its new index. 
+
+static eOsizecntnr_t s_eo_fifo_spsc_size(EOfifo *fifo)
+{
+    const uint32_t n = fifo->dek->capacity;
+    const uint32_t r = fifo->spscread;
+    const uint32_t w = fifo->spscwrite;
+    
+    return((eOsizecntnr_t)((w + n - r) % n));
+}
+
+
+static void * s_eo_fifo_spsc_front(EOfifo *fifo)
+{   // called only by the consumer
+    const eOsizecntnr_t r = fifo->spscread;
+    const eOsizecntnr_t w = fifo->spscwrite;
+    
+    s_eo_fifo_spsc_barrier();
+    
+    return((r == w) ? (NULL) : (s_eo_fifo_slot(fifo, r)));
+}
+
+
+static eOsizecntnr_t s_eo_fifo_spsc_put(EOfifo *fifo, const uint8_t *items, eOsizecntnr_t number)
+{   // called only by the producer
+    EOdeque *dek = fifo->dek;
+    const uint32_t n = dek->capacity;
+    uint32_t w = fifo->spscwrite;
+    const uint32_t r = fifo->spscread;
+    uint32_t available = 0;
+    uint32_t i = 0;
+    
+    // the consumer must be done with the items before we overwrite them
+    s_eo_fifo_spsc_barrier();
+    
+    available = (r + n - w - 1) % n;
+    if(number > available)
+    {
+        number = (eOsizecntnr_t)available;
+    }
+    
+    if(NULL == dek->item_copy_fn)
+    {   // at most two memcpy(): until the end of the array and then from its start
+        uint32_t first = ((n - w) < number) ? (n - w) : (number);
+        memcpy(s_eo_fifo_slot(fifo, (eOsizecntnr_t)w), items, first*dek->item_size);
+        memcpy(s_eo_fifo_slot(fifo, 0), items + first*dek->item_size, (number - first)*dek->item_size);
+        w = (w + number) % n;
+    }
+    else
+    {
+        for(i=0; i<number; i++)
+        {
+            dek->item_copy_fn(s_eo_fifo_slot(fifo, (eOsizecntnr_t)w), (void*)(items + i*dek->item_size));
+            w = (w + 1) % n;
+        }
+    }
+    
+    // the items must be visible before the index which publishes them
+    s_eo_fifo_spsc_barrier();
+    fifo->spscwrite = (eOsizecntnr_t)w;
+    
+    return(number);
+}
+
+
+static eOsizecntnr_t s_eo_fifo_spsc_getrem(EOfifo *fifo, uint8_t *items, eOsizecntnr_t number)
+{   // called only by the consumer. if items is NULL, the items are just removed
+    EOdeque *dek = fifo->dek;
+    const uint32_t n = dek->capacity;
+    uint32_t r = fifo->spscread;
+    const uint32_t w = fifo->spscwrite;
+    uint32_t available = 0;
+    uint32_t i = 0;
+    
+    // the items must be read after the index which published them
+    s_eo_fifo_spsc_barrier();
+    
+    available = (w + n - r) % n;
+    if(number > available)
+    {
+        number = (eOsizecntnr_t)available;
+    }
+    
+    if((NULL == dek->item_copy_fn) && (NULL == dek->item_clear_fn))
+    {   // at most two memcpy(): until the end of the array and then from its start
+        if(NULL != items)
+        {
+            uint32_t first = ((n - r) < number) ? (n - r) : (number);
+            memcpy(items, s_eo_fifo_slot(fifo, (eOsizecntnr_t)r), first*dek->item_size);
+            memcpy(items + first*dek->item_size, s_eo_fifo_slot(fifo, 0), (number - first)*dek->item_size);
+        }
+        r = (r + number) % n;
+    }
+    else
+    {
+        for(i=0; i<number; i++)
+        {
+            uint8_t *slot = s_eo_fifo_slot(fifo, (eOsizecntnr_t)r);
+            if(NULL != items)
+            {
+                if(NULL != dek->item_copy_fn) 
+                {
+                    dek->item_copy_fn(items + i*dek->item_size, slot);
+                }
+                else
+                {
+                    memcpy(items + i*dek->item_size, slot, dek->item_size);
+                }
+            }
+            if(NULL != dek->item_clear_fn)
+            {
+                dek->item_clear_fn(slot);
+            }
+            r = (r + 1) % n;
+        }
+    }
+    
+    // we must be done with the items before the producer sees them as free
+    s_eo_fifo_spsc_barrier();
+    fifo->spscread = (eOsizecntnr_t)r;
+    
+    return(number);
+}
+
+
+static eOsizecntnr_t s_eo_fifo_dek_put(EOfifo *fifo, const uint8_t *items, eOsizecntnr_t number)
+{
+    return(eo_deque_PushBackMany(fifo->dek, items, number));
+}
+
+
+static eOsizecntnr_t s_eo_fifo_dek_getrem(EOfifo *fifo, uint8_t *items, eOsizecntnr_t number)
+{
+    return(eo_deque_PopFrontMany(fifo->dek, items, number));
+}
 
 
 
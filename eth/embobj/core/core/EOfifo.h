@@ -92,6 +92,22 @@ extern EOfifo * eo_fifo_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
                             eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear,
                             EOVmutexDerived *mutex);
 
+
+/** @fn         extern EOfifo * eo_fifo_NewSPSC(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                                eOres_fp_voidp_uint32_t item_init, uint32_t init_arg, 
+                                                eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear)
+    @brief      Creates a new EOfifo object which is used by a single producer and a single consumer (e.g., an ISR and 
+                a thread) without any mutex. The producer can call only eo_fifo_Put() and eo_fifo_PutMany(). The 
+                consumer can call only eo_fifo_Get(), eo_fifo_Rem(), eo_fifo_GetRem(), eo_fifo_GetRemMany() and 
+                eo_fifo_Clear(). Both can call eo_fifo_Size() and eo_fifo_Capacity(). None of them ever waits, thus 
+                the tout argument is ignored. The parameters are those of eo_fifo_New(). 
+                It requires a platform where EO_atomic_barrier() is defined, otherwise the error manager is called.
+    @return     Const pointer to the required EOfifo object. The pointer is always not NULL. 
+ **/
+extern EOfifo * eo_fifo_NewSPSC(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                eOres_fp_voidp_uint32_t item_init, uint32_t init_arg, 
+                                eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear);
+
 /** @fn         extern void eo_fifo_Delete(EOfifo * fifo)
     @brief      deletes the fifo, it calls eo_fifo_Clear() before destroying the objects.
     @param      fifo            Pointer to the EOfifo object.
@@ -169,6 +185,34 @@ extern eOresult_t eo_fifo_Rem(EOfifo *fifo, eOreltime_t tout);
 extern eOresult_t eo_fifo_GetRem(EOfifo *fifo, void *pitem, eOreltime_t tout);
 
 
+/** @fn         extern eOresult_t eo_fifo_PutMany(EOfifo *fifo, const void *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout)
+    @brief      Copies in the fifo queue the @e number items which are contiguous in the memory pointed by @e items, 
+                or as many as fit. The mutex, if any, is taken only once.
+    @param      fifo            Pointer to the EOfifo object.
+    @param      items           Pointer to the array of items to be copied. 
+    @param      number          The number of items in the array.
+    @param      put             If not NULL, it receives the number of copied items.
+    @param      tout            Timeout for the operation in micro-seconds.
+    @return     eores_OK if all the items were copied, eores_NOK_busy if the queue became full before, eores_NOK_nullpointer 
+                if fifo or items is NULL, eores_NOK_timeout if the mutex was busy within the specified timeout.
+ **/
+extern eOresult_t eo_fifo_PutMany(EOfifo *fifo, const void *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifo_GetRemMany(EOfifo *fifo, void *items, eOsizecntnr_t capacity, eOsizecntnr_t *got, eOreltime_t tout)
+    @brief      Copies in the array pointed by @e items up to @e capacity first-in items of the fifo and removes them 
+                from the fifo. The mutex, if any, is taken only once.
+    @param      fifo            Pointer to the EOfifo object.
+    @param      items           Pointer to the array which receives the items. 
+    @param      capacity        The number of items which the array can contain.
+    @param      got             If not NULL, it receives the number of retrieved items.
+    @param      tout            Timeout for the operation in micro-seconds.
+    @return     eores_OK if at least one item was retrieved, eores_NOK_nodata if fifo is empty, eores_NOK_nullpointer 
+                if fifo or items is NULL, eores_NOK_timeout if the mutex was busy within the specified timeout. 
+ **/
+extern eOresult_t eo_fifo_GetRemMany(EOfifo *fifo, void *items, eOsizecntnr_t capacity, eOsizecntnr_t *got, eOreltime_t tout);
+
+
 /** @fn         eOresult_t eo_fifo_Clear(EOfifo *fifo, eOreltime_t tout)
     @brief      removes every object in the fifo queue.
     @param      fifo            Pointer to the EOfifo object.
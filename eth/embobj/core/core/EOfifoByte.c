@@ -99,6 +99,20 @@ extern EOfifoByte* eo_fifobyte_New(eOsizecntnr_t capacity, EOVmutexDerived *mute
 }
 
 
+extern EOfifoByte* eo_fifobyte_NewSPSC(eOsizecntnr_t capacity) 
+{
+    EOfifoByte *retptr = NULL; 
+    
+    retptr = (EOfifoByte*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOfifoByte), 1);
+    
+    eo_errman_Assert(eo_errman_GetHandle(), (0 != capacity), "eo_fifobyte_NewSPSC(): 0 capacity", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    
+    retptr->fifo = eo_fifo_NewSPSC(1, capacity, NULL, 0, NULL, NULL);
+    
+    return(retptr);
+}
+
+
 extern void eo_fifobyte_Delete(EOfifoByte *fifobyte) 
 {
     if(NULL == fifobyte)
@@ -196,6 +210,26 @@ extern eOresult_t eo_fifobyte_Clear(EOfifoByte *fifobyte, eOreltime_t tout)
     return(eo_fifo_Clear(fifobyte->fifo, tout));
 }
 
+
+extern eOresult_t eo_fifobyte_PutMany(EOfifoByte *fifobyte, const uint8_t *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout) 
+{
+    if(NULL == fifobyte)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    return(eo_fifo_PutMany(fifobyte->fifo, items, number, put, tout));
+}
+
+
+extern eOresult_t eo_fifobyte_GetRemMany(EOfifoByte *fifobyte, uint8_t *items, eOsizecntnr_t capacity, eOsizecntnr_t *got, eOreltime_t tout) 
+{
+    if(NULL == fifobyte)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    return(eo_fifo_GetRemMany(fifobyte->fifo, items, capacity, got, tout));
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -82,6 +82,15 @@ typedef struct EOfifoByte_hid EOfifoByte;
 extern EOfifoByte* eo_fifobyte_New(eOsizecntnr_t capacity, EOVmutexDerived *mutex);
 
 
+/** @fn         extern EOfifoByte* eo_fifobyte_NewSPSC(eOsizecntnr_t capacity)
+    @brief      Creates a new EOfifoByte object for a single producer and a single consumer which does not use any mutex. 
+                See eo_fifo_NewSPSC() for the functions that each side can call.
+    @param      capacity        Maximum number of byte items that will be stored in the fifobyte queue
+    @return     Pointer to the object. The function always returns a valid not NULL pointer.
+ **/
+extern EOfifoByte* eo_fifobyte_NewSPSC(eOsizecntnr_t capacity);
+
+
  
 /** @fn         extern void eo_fifobyte_Delete(EOfifoByte *fifobyte)
     @brief      deletes the fifobyte queue. it clears the object before.
@@ -155,6 +164,22 @@ extern eOresult_t eo_fifobyte_Rem(EOfifoByte *fifobyte, eOreltime_t tout);
 extern eOresult_t eo_fifobyte_Clear(EOfifoByte *fifobyte, eOreltime_t tout);
 
 
+/** @fn         extern eOresult_t eo_fifobyte_PutMany(EOfifoByte *fifobyte, const uint8_t *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout)
+    @brief      Copies the @e number bytes in @e items in the fifobyte queue, or as many as fit. See eo_fifo_PutMany().
+    @return     eores_OK if all the bytes were copied, eores_NOK_busy if the queue became full before, eores_NOK_nullpointer
+                if fifobyte is NULL, eores_NOK_timeout if the mutex was busy within the specified timeout
+ **/ 
+extern eOresult_t eo_fifobyte_PutMany(EOfifoByte *fifobyte, const uint8_t *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifobyte_GetRemMany(EOfifoByte *fifobyte, uint8_t *items, eOsizecntnr_t capacity, eOsizecntnr_t *got, eOreltime_t tout)
+    @brief      Moves up to @e capacity first-in bytes of the fifobyte queue into @e items. See eo_fifo_GetRemMany().
+    @return     eores_OK if at least one byte was retrieved, eores_NOK_nodata if fifobyte is empty, eores_NOK_nullpointer 
+                if fifobyte is NULL, eores_NOK_timeout if the mutex was busy within the specified timeout
+ **/ 
+extern eOresult_t eo_fifobyte_GetRemMany(EOfifoByte *fifobyte, uint8_t *items, eOsizecntnr_t capacity, eOsizecntnr_t *got, eOreltime_t tout);
+
+
 /** @}            
     end of group eo_fifobyte  
  **/
@@ -99,6 +99,20 @@ extern EOfifoWord* eo_fifoword_New(eOsizecntnr_t capacity, EOVmutexDerived *mute
 }
 
 
+extern EOfifoWord* eo_fifoword_NewSPSC(eOsizecntnr_t capacity) 
+{
+    EOfifoWord *retptr = NULL; 
+    
+    retptr = (EOfifoWord*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOfifoWord), 1);
+    
+    eo_errman_Assert(eo_errman_GetHandle(), (0 != capacity), "eo_fifoword_NewSPSC(): 0 capacity", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    
+    retptr->fifo = eo_fifo_NewSPSC(4, capacity, NULL, 0, NULL, NULL);
+    
+    return(retptr);
+}
+
+
 extern void eo_fifoword_Delete(EOfifoWord *fifoword) 
 {
     if(NULL == fifoword)
@@ -197,6 +211,26 @@ extern eOresult_t eo_fifoword_Clear(EOfifoWord *fifoword, eOreltime_t tout)
 }
 
 
+extern eOresult_t eo_fifoword_PutMany(EOfifoWord *fifoword, const uint32_t *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout) 
+{
+    if(NULL == fifoword)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    return(eo_fifo_PutMany(fifoword->fifo, items, number, put, tout));
+}
+
+
+extern eOresult_t eo_fifoword_GetRemMany(EOfifoWord *fifoword, uint32_t *items, eOsizecntnr_t capacity, eOsizecntnr_t *got, eOreltime_t tout) 
+{
+    if(NULL == fifoword)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    return(eo_fifo_GetRemMany(fifoword->fifo, items, capacity, got, tout));
+}
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
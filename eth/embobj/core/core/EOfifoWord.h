@@ -82,6 +82,15 @@ typedef struct EOfifoWord_hid EOfifoWord;
 extern EOfifoWord* eo_fifoword_New(eOsizecntnr_t capacity, EOVmutexDerived *mutex);
 
 
+/** @fn         extern EOfifoWord* eo_fifoword_NewSPSC(eOsizecntnr_t capacity)
+    @brief      Creates a new EOfifoWord object for a single producer and a single consumer which does not use any mutex. 
+                See eo_fifo_NewSPSC() for the functions that each side can call.
+    @param      capacity        Maximum number of word items that will be stored in the fifoword queue
+    @return     Pointer to the object. The function always returns a valid not NULL pointer.
+ **/
+extern EOfifoWord* eo_fifoword_NewSPSC(eOsizecntnr_t capacity);
+
+
 /** @fn         extern void eo_fifoword_Delete(EOfifoWord *fifoword)
     @brief      deletes the fifoword queue. it clears the object first.
     @param      fifoword        Pointer to the fifo object.
@@ -154,6 +163,22 @@ extern eOresult_t eo_fifoword_Rem(EOfifoWord *fifo, eOreltime_t tout);
 extern eOresult_t eo_fifoword_Clear(EOfifoWord *fifo, eOreltime_t tout);
 
 
+/** @fn         extern eOresult_t eo_fifoword_PutMany(EOfifoWord *fifoword, const uint32_t *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout)
+    @brief      Copies the @e number words in @e items in the fifoword queue, or as many as fit. See eo_fifo_PutMany().
+    @return     eores_OK if all the words were copied, eores_NOK_busy if the queue became full before, eores_NOK_nullpointer
+                if fifoword is NULL, eores_NOK_timeout if the mutex was busy within the specified timeout
+ **/ 
+extern eOresult_t eo_fifoword_PutMany(EOfifoWord *fifoword, const uint32_t *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifoword_GetRemMany(EOfifoWord *fifoword, uint32_t *items, eOsizecntnr_t capacity, eOsizecntnr_t *got, eOreltime_t tout)
+    @brief      Moves up to @e capacity first-in words of the fifoword queue into @e items. See eo_fifo_GetRemMany().
+    @return     eores_OK if at least one word was retrieved, eores_NOK_nodata if fifoword is empty, eores_NOK_nullpointer 
+                if fifoword is NULL, eores_NOK_timeout if the mutex was busy within the specified timeout
+ **/ 
+extern eOresult_t eo_fifoword_GetRemMany(EOfifoWord *fifoword, uint32_t *items, eOsizecntnr_t capacity, eOsizecntnr_t *got, eOreltime_t tout);
+
+
 /** @}            
     end of group eo_fifoword  
  **/
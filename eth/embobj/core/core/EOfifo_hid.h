@@ -54,6 +54,11 @@ struct EOfifo_hid
     EOdeque                 *dek;
     EOVmutexDerived         *mutex;
     // other stuff
+    // the lock-free mode of eo_fifo_NewSPSC() uses dek only as an array of capacity+1 items, and keeps in here
+    // the index of the first item, written only by the consumer, and the index of the next free item, written only by the producer.
+    eObool_t                spsc;
+    volatile eOsizecntnr_t  spscread;
+    volatile eOsizecntnr_t  spscwrite;
 };
 
 #ifdef __cplusplus
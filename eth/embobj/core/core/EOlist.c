@@ -89,7 +89,11 @@ EO_static_inline void s_eo_list_default_init(void* item,  EOlist* list)
 
 EO_static_inline void* s_eo_list_get_data(EOlist *list, EOlistIter *li)
 {
-    if(list->item_size > sizeof(void*))
+    if(NULL != list->slots)
+    {   // contiguous mode: the item is inside the slot
+        return((uint8_t*)li + list->itemoffset);
+    }
+    else if(list->item_size > sizeof(void*))
     {
         return(li->data);
     }
@@ -99,17 +103,68 @@ EO_static_inline void* s_eo_list_get_data(EOlist *list, EOlistIter *li)
     }
 }
 
-static EOlistIter * s_eo_list_push_front(EOlistIter *head, EOlistIter *li);
-static EOlistIter * s_eo_list_push_back(EOlistIter *tail, EOlistIter *li);
-static EOlistIter * s_eo_list_insert_before(EOlistIter *head, EOlistIter *iter, EOlistIter *li);
-static EOlistIter * s_eo_list_rem_front(EOlistIter *head);
-static EOlistIter * s_eo_list_rem_back(EOlistIter *tail);
-//static EOlistIter * s_eo_list_rem_iter(EOlistIter *head, EOlistIter *li);
+// in contiguous mode an iterator is the address of its slot and the links are the indices of the slots
+
+EO_static_inline EOlistIter* s_eo_list_slot2iter(EOlist *list, uint16_t index)
+{
+    return((eo_list_noslot == index) ? (NULL) : ((EOlistIter*)(list->slots + (uint32_t)index*list->slotsize)));
+}
+
+EO_static_inline uint16_t s_eo_list_iter2slot(EOlist *list, EOlistIter *li)
+{
+    return((NULL == li) ? (eo_list_noslot) : ((uint16_t)(((uint8_t*)li - list->slots) / list->slotsize)));
+}
+
+EO_static_inline EOlistIter* s_eo_list_link_next(EOlist *list, EOlistIter *li)
+{
+    return((NULL == list->slots) ? (li->next) : (s_eo_list_slot2iter(list, ((eOlist_slot_t*)li)->next)));
+}
+
+EO_static_inline EOlistIter* s_eo_list_link_prev(EOlist *list, EOlistIter *li)
+{
+    return((NULL == list->slots) ? (li->prev) : (s_eo_list_slot2iter(list, ((eOlist_slot_t*)li)->prev)));
+}
+
+EO_static_inline void s_eo_list_link_setnext(EOlist *list, EOlistIter *li, EOlistIter *next)
+{
+    if(NULL == list->slots)
+    {
+        li->next = next;
+    }
+    else
+    {
+        ((eOlist_slot_t*)li)->next = s_eo_list_iter2slot(list, next);
+    }
+}
+
+EO_static_inline void s_eo_list_link_setprev(EOlist *list, EOlistIter *li, EOlistIter *prev)
+{
+    if(NULL == list->slots)
+    {
+        li->prev = prev;
+    }
+    else
+    {
+        ((eOlist_slot_t*)li)->prev = s_eo_list_iter2slot(list, prev);
+    }
+}
+
+static EOlist* s_eo_list_new(eOsizeitem_t item_size, eOsizecntnr_t capacity, 
+                             eOres_fp_voidp_uint32_t item_init, uint32_t init_par,
+                             eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear, eObool_t contiguous);
+
+static void s_eo_list_slots_create(EOlist *list);
+
+static EOlistIter * s_eo_list_push_front(EOlist *list, EOlistIter *head, EOlistIter *li);
+static EOlistIter * s_eo_list_push_back(EOlist *list, EOlistIter *tail, EOlistIter *li);
+static EOlistIter * s_eo_list_insert_before(EOlist *list, EOlistIter *head, EOlistIter *iter, EOlistIter *li);
+static EOlistIter * s_eo_list_rem_front(EOlist *list, EOlistIter *head);
+static EOlistIter * s_eo_list_rem_back(EOlist *list, EOlistIter *tail);
 static void s_eo_list_rem_any(EOlist *list, EOlistIter *li);
 static EOlistIter * s_eo_list_front(EOlist *list);
 static EOlistIter * s_eo_list_back(EOlist *list);
-static EOlistIter * s_eo_list_iter_next(EOlistIter *li);
-static EOlistIter * s_eo_list_iter_prev(EOlistIter *li);
+static EOlistIter * s_eo_list_iter_next(EOlist *list, EOlistIter *li);
+static EOlistIter * s_eo_list_iter_prev(EOlist *list, EOlistIter *li);
 
 static void s_eo_list_copy_item_into_iterator(EOlist *list, EOlistIter *li, void *p);
 static void s_eo_list_clean_iterator(EOlist *list, EOlistIter *li);
@@ -137,45 +192,15 @@ extern EOlist* eo_list_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
                            eOres_fp_voidp_uint32_t item_init, uint32_t init_par,
                            eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear)
 {
-    EOlist *retptr = NULL;
-    eOsizecntnr_t i = 0; 
-
-
-    // i get the memory for the object
-    retptr = (EOlist*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOlist), 1);
-
-    
-    // now the obj has valid memory. i need to initialise it with user-defined data,
-    retptr->head            = NULL;
-    retptr->tail            = NULL;
-    retptr->size            = 0;
- 
-    eo_errman_Assert(eo_errman_GetHandle(), (0 != item_size), "eo_list_New(): 0 item_size", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
-    eo_errman_Assert(eo_errman_GetHandle(), (0 != capacity), "eo_list_New(): 0 capacity", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    return(s_eo_list_new(item_size, capacity, item_init, init_par, item_copy, item_clear, eobool_false));
+}
 
-    retptr->capacity            = capacity;
-    retptr->item_size           = item_size;
-    retptr->item_init_fn        = item_init;
-    retptr->item_init_par       = init_par;    
-    retptr->item_copy_fn        = item_copy;
-    retptr->item_clear_fn       = item_clear;
-    
-    if(eo_listcapacity_dynamic == retptr->capacity)
-    {
-        eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_list_New(): eo_vectorcapacity_dynamic only if eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
-        retptr->freeiters = NULL;        
-    }
-    else
-    {   
-        for(i=0; i<capacity; i++) 
-        {
-            EOlistIter *li = s_eo_list_iterator_create(retptr);    
-            retptr->freeiters = s_eo_list_push_front(retptr->freeiters, li);
-        } 
 
-    }    
-
-    return(retptr);
+extern EOlist* eo_list_NewContiguous(eOsizeitem_t item_size, eOsizecntnr_t capacity, 
+                                     eOres_fp_voidp_uint32_t item_init, uint32_t init_par,
+                                     eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear)
+{
+    return(s_eo_list_new(item_size, capacity, item_init, init_par, item_copy, item_clear, eobool_true));
 }
 
 
@@ -253,7 +278,7 @@ extern void eo_list_PushFront(EOlist *list, void *p)
         }
 
         // insert the iter in front of the head
-        list->head = s_eo_list_push_front(list->head, tmpiter);
+        list->head = s_eo_list_push_front(list, list->head, tmpiter);
 
         // increment size of the list    
         list->size ++;
@@ -315,7 +340,7 @@ extern void eo_list_PushBack(EOlist *list, void *p)
         }
 
         // insert the iter after the tail
-        list->tail = s_eo_list_push_back(list->tail, tmpiter);
+        list->tail = s_eo_list_push_back(list, list->tail, tmpiter);
 
         // increment size of the list    
         list->size ++;
@@ -375,7 +400,7 @@ extern void eo_list_Insert(EOlist *list, EOlistIter *li, void *p)
              list->tail = tmpiter;
         }
         // insert the element tmpiter in front of the iter li
-        list->head = s_eo_list_insert_before(list->head, li, tmpiter);
+        list->head = s_eo_list_insert_before(list, list->head, li, tmpiter);
         // increment size of the list    
         list->size ++;
     }
@@ -405,6 +430,12 @@ extern EOlistIter* eo_list_Begin(EOlist *list)
 }
  
 
+extern EOlistIter* eo_list_Last(EOlist *list) 
+{
+    return((NULL == list) ? (NULL) :(s_eo_list_back(list)));         
+}
+
+
 extern EOlistIter* eo_list_Next(EOlist *list, EOlistIter *li) 
 {
     // next in list is simple. if li belongs to list, it is enough to get next of li.
@@ -413,7 +444,7 @@ extern EOlistIter* eo_list_Next(EOlist *list, EOlistIter *li)
     {
         return(NULL);
     }
-    return(s_eo_list_iter_next(li));         
+    return(s_eo_list_iter_next(list, li));         
     
 }
 
@@ -427,7 +458,7 @@ extern EOlistIter* eo_list_Prev(EOlist *list, EOlistIter *li)
     {
         return(NULL);
     }
-    return(s_eo_list_iter_prev(li));         
+    return(s_eo_list_iter_prev(list, li));         
 }
 
 
@@ -443,7 +474,7 @@ extern EOlistIter* eo_list_FindItem(EOlist *list, void *p)
     }
     
     // i navigate from beginning to end until i find a NULL pointer or i break
-    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter)) 
     {
         data = s_eo_list_get_data(list, tmpiter);
         // data is a pointer to what is contained inside the list.
@@ -519,7 +550,7 @@ extern EOlistIter* eo_list_Find(EOlist *list, eOresult_t (matching_rule)(void *i
     }
     
     // i navigate from beginning to end until i find a NULL pointer or i break
-    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter)) 
     {
         data = s_eo_list_get_data(list, tmpiter);
 
@@ -555,7 +586,7 @@ extern void eo_list_Execute(EOlist *list, void (execute)(void *item, void *param
     }
     
     // i navigate from beginning to end until i find a NULL pointer
-    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter)) 
     {
         data = s_eo_list_get_data(list, tmpiter);
         execute(data, param);
@@ -576,7 +607,7 @@ extern void eo_list_ExecuteFromIter(EOlist *list, void (execute)(void *item, voi
     }
     
     // i navigate from li to end until i find a NULL pointer
-    for(tmpiter = li; NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = li; NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter)) 
     {
         data = s_eo_list_get_data(list, tmpiter);
         execute(data, param);
@@ -595,8 +626,13 @@ extern eObool_t eo_list_IsIterInside(EOlist *list, EOlistIter *li)
          return(eobool_false);
     }
     
+    if((NULL != list->slots) && (((uint8_t*)li < list->slots) || ((uint8_t*)li >= (list->slots + (uint32_t)list->capacity*list->slotsize))))
+    {   // it is not even one of our slots
+        return(eobool_false);
+    }
+    
     // i navigate from beginning to end until we find li pointer or we return
-    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter)) 
     {
         if(li == tmpiter) 
         {
@@ -623,7 +659,7 @@ extern void eo_list_PopFront(EOlist *list)
     if(NULL != tmpiter) 
     {
         // i remove it from front of the list
-        list->head = s_eo_list_rem_front(list->head);
+        list->head = s_eo_list_rem_front(list, list->head);
 
         // release it
         s_eo_list_iterator_release(list, tmpiter);
@@ -658,7 +694,7 @@ extern void eo_list_PopBack(EOlist *list)
     if(NULL != tmpiter) 
     {
         // i remove it from end of the list
-        list->tail = s_eo_list_rem_back(list->tail);
+        list->tail = s_eo_list_rem_back(list, list->tail);
 
         // release it
         s_eo_list_iterator_release(list, tmpiter);
@@ -720,6 +756,26 @@ extern void eo_list_Erase(EOlist *list, EOlistIter *li)
 }
 
 
+extern void eo_list_Erase_quickversion(EOlist *list, EOlistIter *li) 
+{
+    // same as eo_list_Erase() but we dont verify that li belongs to list, because it costs a walk of the list.
+    // the caller must be sure of it, for instance because it has kept the iterator since its insertion.
+    if((NULL == list) || (NULL == li) || (0 == list->size)) 
+    {
+        return;    
+    }
+
+    s_eo_list_rem_any(list, li);
+    s_eo_list_iterator_release(list, li);
+    list->size --;
+
+    if(0 == list->size) 
+    {
+         list->tail = NULL;
+    }
+}
+
+
 extern void eo_list_Clear(EOlist *list)
 {
     if(NULL == list) 
@@ -741,14 +797,18 @@ extern void eo_list_Delete(EOlist *list)
         return;    
     }   
     
-    eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_list_Delete(): only if eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (eobool_true == eo_mempool_IsDeleteSupported(eo_mempool_GetHandle())), "eo_list_Delete(): only if eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
   
     // destroy every item. in case of eo_listcapacity_dynamic, each internal listiter is properly deleted and freeiters is NULL
     eo_list_Clear(list);
     
     // destroy freeiters list and its items (not needed)
     //eo_mempool_Delete(eo_mempool_GetHandle(), list->freeiters);
-    if(NULL != list->freeiters) 
+    if(NULL != list->slots)
+    {   // contiguous mode: iterators and items are all inside the slots
+        eo_mempool_Delete(eo_mempool_GetHandle(), list->slots);
+    }
+    else if(NULL != list->freeiters) 
     {   // aka we dont use dymanic mode: we must destroy each element inside freeiters
         uint16_t i;
         for(i=0; i<list->capacity; i++) 
@@ -758,7 +818,7 @@ extern void eo_list_Delete(EOlist *list)
             {
                 break;
             }
-            list->freeiters = s_eo_list_rem_front(list->freeiters);
+            list->freeiters = s_eo_list_rem_front(list, list->freeiters);
             s_eo_list_iterator_destroy(list, li);             
         }         
     }
@@ -783,19 +843,103 @@ extern void eo_list_Delete(EOlist *list)
 // --------------------------------------------------------------------------------------------------------------------
 
 
+static EOlist* s_eo_list_new(eOsizeitem_t item_size, eOsizecntnr_t capacity, 
+                             eOres_fp_voidp_uint32_t item_init, uint32_t init_par,
+                             eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear, eObool_t contiguous)
+{
+    EOlist *retptr = NULL;
+    eOsizecntnr_t i = 0; 
+
+    // i get the memory for the object
+    retptr = (EOlist*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOlist), 1);
+
+    
+    // now the obj has valid memory. i need to initialise it with user-defined data,
+    retptr->head            = NULL;
+    retptr->tail            = NULL;
+    retptr->size            = 0;
+ 
+    eo_errman_Assert(eo_errman_GetHandle(), (0 != item_size), "eo_list_New(): 0 item_size", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (0 != capacity), "eo_list_New(): 0 capacity", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+
+    retptr->capacity            = capacity;
+    retptr->item_size           = item_size;
+    retptr->item_init_fn        = item_init;
+    retptr->item_init_par       = init_par;    
+    retptr->item_copy_fn        = item_copy;
+    retptr->item_clear_fn       = item_clear;
+    retptr->slots               = NULL;
+    retptr->slotsize            = 0;
+    retptr->itemoffset          = 0;
+    
+    if(eobool_true == contiguous)
+    {
+        eo_errman_Assert(eo_errman_GetHandle(), (eo_listcapacity_dynamic != capacity), "eo_list_NewContiguous(): eo_listcapacity_dynamic", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+        s_eo_list_slots_create(retptr);
+    }
+    else if(eo_listcapacity_dynamic == retptr->capacity)
+    {
+        eo_errman_Assert(eo_errman_GetHandle(), (eobool_true == eo_mempool_IsDeleteSupported(eo_mempool_GetHandle())), "eo_list_New(): eo_vectorcapacity_dynamic only if eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+        retptr->freeiters = NULL;        
+    }
+    else
+    {   
+        for(i=0; i<capacity; i++) 
+        {
+            EOlistIter *li = s_eo_list_iterator_create(retptr);    
+            retptr->freeiters = s_eo_list_push_front(retptr, retptr->freeiters, li);
+        } 
+
+    }    
+
+    return(retptr);
+}
+
+
+static void s_eo_list_slots_create(EOlist *list)
+{
+    // the items are aligned as a pointer, so that those which contain pointers are correctly accessed also on 64-bit hosts
+    const uint16_t align = sizeof(void*);
+    uint16_t i = 0;
+    
+    list->itemoffset    = (sizeof(eOlist_slot_t) + align - 1) / align * align;
+    list->slotsize      = list->itemoffset + (list->item_size + align - 1) / align * align;
+    list->slots         = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, list->slotsize, list->capacity);
+    
+    // we push the slots in reverse order, so that they are used from the first one and the list grows towards higher addresses
+    list->freeiters = NULL;
+    for(i=list->capacity; i>0; i--)
+    {
+        EOlistIter *li = s_eo_list_slot2iter(list, i-1);
+        void *item = s_eo_list_get_data(list, li);
+        
+        if(NULL != list->item_init_fn)
+        {
+            list->item_init_fn(item, list->item_init_par);
+        }
+        else
+        {
+            s_eo_list_default_init(item, list);
+        }
+        
+        list->freeiters = s_eo_list_push_front(list, list->freeiters, li);
+    }
+}
+
+
 // returns the head
-static EOlistIter * s_eo_list_push_front(EOlistIter *head, EOlistIter *li) 
+static EOlistIter * s_eo_list_push_front(EOlist *list, EOlistIter *head, EOlistIter *li) 
 {
     EOlistIter *oldhead = head;
     
-    li->prev = NULL;
-    li->next = head;
+    s_eo_list_link_setprev(list, li, NULL);
+    s_eo_list_link_setnext(list, li, head);
     
     head = li;
     
     if(NULL != oldhead) 
     {
-        oldhead->prev = head;
+        s_eo_list_link_setprev(list, oldhead, head);
     }
     
     return(head);
@@ -803,18 +947,18 @@ static EOlistIter * s_eo_list_push_front(EOlistIter *head, EOlistIter *li)
 
 
 // returns teh tail
-static EOlistIter * s_eo_list_push_back(EOlistIter *tail, EOlistIter *li) 
+static EOlistIter * s_eo_list_push_back(EOlist *list, EOlistIter *tail, EOlistIter *li) 
 {
     EOlistIter *oldtail = tail;
     
-    li->prev = tail;
-    li->next = NULL;
+    s_eo_list_link_setprev(list, li, tail);
+    s_eo_list_link_setnext(list, li, NULL);
     
     tail = li;
     
     if(NULL != oldtail) 
     {
-        oldtail->next = tail;
+        s_eo_list_link_setnext(list, oldtail, tail);
     }
     
     return(tail);
@@ -822,28 +966,28 @@ static EOlistIter * s_eo_list_push_back(EOlistIter *tail, EOlistIter *li)
 
 
 // returns the head
-static EOlistIter * s_eo_list_insert_before(EOlistIter *head, EOlistIter *iter, EOlistIter *li) 
+static EOlistIter * s_eo_list_insert_before(EOlist *list, EOlistIter *head, EOlistIter *iter, EOlistIter *li) 
 {
     
     if(iter == head)
     {
-        return(s_eo_list_push_front(head, li));
+        return(s_eo_list_push_front(list, head, li));
     }
     else
     {
         // iter is not null, if iter is not the head, then ... also iter->prev is not NULL
         // pre is teh node before iter
-        EOlistIter *pre = iter->prev;
+        EOlistIter *pre = s_eo_list_link_prev(list, iter);
 
         // fix the links of li
-        li->prev = pre;
-        li->next = iter;
+        s_eo_list_link_setprev(list, li, pre);
+        s_eo_list_link_setnext(list, li, iter);
 
         // fix the link of pre
-        pre->next = li;
+        s_eo_list_link_setnext(list, pre, li);
 
         // fix the link of iter
-        iter->prev = li;
+        s_eo_list_link_setprev(list, iter, li);
 
         // the head remains the same
         return(head);
@@ -853,7 +997,7 @@ static EOlistIter * s_eo_list_insert_before(EOlistIter *head, EOlistIter *iter,
 
  
 // returns the head
-static EOlistIter * s_eo_list_rem_front(EOlistIter *head) 
+static EOlistIter * s_eo_list_rem_front(EOlist *list, EOlistIter *head) 
 {
     EOlistIter *oldhead = head;
     
@@ -862,25 +1006,22 @@ static EOlistIter * s_eo_list_rem_front(EOlistIter *head)
         return(NULL);    
     }
     
-    if(NULL == oldhead->next) 
-    {
-        // only one element in current list
-        return(NULL);
-    } 
-    else 
+    head = s_eo_list_link_next(list, oldhead);
+    
+    if(NULL != head) 
     {
         // at least two elements
-        head = oldhead->next;
-        head->prev = NULL;
+        s_eo_list_link_setprev(list, head, NULL);
     }
     
-
+    // else: only one element in current list
+    
     return(head);
 }
 
 
 // returns the tail
-static EOlistIter * s_eo_list_rem_back(EOlistIter *tail) 
+static EOlistIter * s_eo_list_rem_back(EOlist *list, EOlistIter *tail) 
 {
     EOlistIter *oldtail = tail;
     
@@ -889,66 +1030,23 @@ static EOlistIter * s_eo_list_rem_back(EOlistIter *tail)
         return(NULL);    
     }
     
-    if(NULL == oldtail->prev) 
-    {
-        // only one element in current list
-        return(NULL);
-    } 
-    else 
+    tail = s_eo_list_link_prev(list, oldtail);
+    
+    if(NULL != tail) 
     {
         // at least two elements
-        tail = oldtail->prev;
-        tail->next = NULL;
+        s_eo_list_link_setnext(list, tail, NULL);
     }
     
+    // else: only one element in current list
 
     return(tail);
 }
 
 
-
-// returns the head
-//static EOlistIter * s_eo_list_rem_iter(EOlistIter *head, EOlistIter *li) 
-//{
-//    EOlistIter *newhead = head;
-//    
-//    if(NULL == head) 
-//    {
-//        return(NULL);    
-//    }
-//
-//    if(NULL == li) 
-//    {
-//         return(newhead);
-//    }
-//
-//    // head and li are not NULL
-//    if(li == head) 
-//    {
-//         // li is the head, thus remove li from the front.
-//        newhead = s_eo_list_rem_front(head);
-//    }
-//    else if(NULL == li->next) 
-//    {
-//        // li is the tail, thus ...
-//        li->prev->next = NULL;
-//    }
-//    else 
-//    {
-//         // li is in the middle
-//        li->prev->next = li->next;
-//        li->next->prev = li->prev;
-//    }
-//
-//
-//    return(newhead);
-//}
-
-
 static void s_eo_list_rem_any(EOlist *list, EOlistIter *li) 
 {
     EOlistIter *head = list->head;
-//    EOlistIter *newhead = list->head;
     
     if(NULL == list->head) 
     {
@@ -964,18 +1062,20 @@ static void s_eo_list_rem_any(EOlist *list, EOlistIter *li)
     if(li == list->head) 
     {
          // li is the head, thus remove li from the front.
-        list->head = s_eo_list_rem_front(head);
+        list->head = s_eo_list_rem_front(list, head);
     }
     else if(li == list->tail) 
     {
         // li is the tail, thus ...
-        list->tail = s_eo_list_rem_back(list->tail);
+        list->tail = s_eo_list_rem_back(list, list->tail);
     }
     else 
     {
          // li is in the middle
-        li->prev->next = li->next;
-        li->next->prev = li->prev;
+        EOlistIter *prev = s_eo_list_link_prev(list, li);
+        EOlistIter *next = s_eo_list_link_next(list, li);
+        s_eo_list_link_setnext(list, prev, next);
+        s_eo_list_link_setprev(list, next, prev);
     }
 
 }
@@ -993,25 +1093,25 @@ static EOlistIter * s_eo_list_back(EOlist *list)
 }
 
 
-static EOlistIter * s_eo_list_iter_next(EOlistIter *li) 
+static EOlistIter * s_eo_list_iter_next(EOlist *list, EOlistIter *li) 
 {
     if(NULL == li) 
     {
          return(NULL);
     }
 
-    return(li->next);
+    return(s_eo_list_link_next(list, li));
 }  
 
 
-static EOlistIter * s_eo_list_iter_prev(EOlistIter *li) 
+static EOlistIter * s_eo_list_iter_prev(EOlist *list, EOlistIter *li) 
 {
     if(NULL == li) 
     {
          return(NULL);
     }
 
-    return(li->prev);
+    return(s_eo_list_link_prev(list, li));
 }  
 
 
@@ -1135,7 +1235,7 @@ static EOlistIter* s_eo_list_iterator_get(EOlist* list)
     {   // get the first free iter
         li = list->freeiters;
         // and i remove it from front of the free list. the following s_eo_list_rem_front() does nothing is argument is NULL.
-        list->freeiters = s_eo_list_rem_front(list->freeiters);
+        list->freeiters = s_eo_list_rem_front(list, list->freeiters);
     }
     
     return(li);
@@ -1152,7 +1252,7 @@ static void s_eo_list_iterator_release(EOlist* list, EOlistIter* li)
     }
     else
     {   // i put li back into the free iters
-        list->freeiters = s_eo_list_push_front(list->freeiters, li);
+        list->freeiters = s_eo_list_push_front(list, list->freeiters, li);
     }
 }
 
@@ -104,6 +104,21 @@ extern EOlist* eo_list_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
                            eOres_fp_voidp_uint32_t item_init, uint32_t init_par,
                            eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear);
 
+
+/** @fn         extern EOlist* eo_list_NewContiguous(eOsizeitem_t item_size, eOsizecntnr_t capacity, 
+                                                     eOres_fp_voidp_uint32_t item_init, uint32_t init_par,
+                                                     eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear)
+    @brief      Same as eo_list_New() but the list keeps its iterators and its items in a single array of 
+                capacity slots which are linked by 16-bit indices. The iteration and the search functions 
+                thus walk through contiguous memory. The rest of the API is unchanged.
+    @param      capacity        The max number of item objects stored by the EOlist. It cannot be 
+                                eo_listcapacity_dynamic.
+    @return     Pointer to the required EOlist object.
+ **/ 
+extern EOlist* eo_list_NewContiguous(eOsizeitem_t item_size, eOsizecntnr_t capacity, 
+                                     eOres_fp_voidp_uint32_t item_init, uint32_t init_par,
+                                     eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear);
+
 /** @fn         extern eOsizecntnr_t eo_list_Capacity(EOlist *list)
     @brief      Returns the maximum number of item objects that the EOlist is able to contain.
     @param      list           Pointer to the EOlist object.
@@ -215,6 +230,15 @@ extern void eo_list_PopFront(EOlist *list);
 extern void eo_list_Erase(EOlist *list, EOlistIter *li);
 
 
+/** @fn         extern void eo_list_Erase_quickversion(EOlist *list, EOlistIter *li)
+    @brief      Same as eo_list_Erase() but it does not verify that @e li belongs to the list, thus it
+                does not walk the list and executes in constant time.
+    @param      list            Pointer to the EOlist object.
+    @param      li              The list iterator. It MUST belong to @e list.
+ **/
+extern void eo_list_Erase_quickversion(EOlist *list, EOlistIter *li);
+
+
 /** @fn         extern void eo_list_Clear(EOlist *list)
     @brief      Removes all item objects from the EOlist and for each one calls its destructor 
                 @e item_dtor() if passed not NULL in eo_list_new(). Finally sets memory to zero.
@@ -233,6 +257,14 @@ extern void eo_list_Clear(EOlist *list);
 extern EOlistIter* eo_list_Begin(EOlist *list);
 
 
+/** @fn         extern EOlistIter* eo_list_Last(EOlist *list)
+    @brief      Returns a list iterator pointing to the last item of the list.
+    @param      list            Pointer to the EOlist object.
+    @return     The list iterator (or NULL if the list is empty).
+ **/
+extern EOlistIter* eo_list_Last(EOlist *list);
+
+
 /** @fn         extern EOlistIter* eo_list_Next(EOlist *list, EOlistIter *li)
     @brief      Increments the iterator to next position in the list. 
     @param      list            Pointer to the EOlist object.
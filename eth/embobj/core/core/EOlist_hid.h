@@ -41,7 +41,8 @@ extern "C" {
 
 
 // - #define used with hidden struct ----------------------------------------------------------------------------------
-// empty-section
+
+enum { eo_list_noslot = EOK_uint16dummy };
 
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
@@ -59,6 +60,17 @@ struct EOlistIter_hid
 };
 
 
+/* @struct     eOlist_slot_t
+    @brief      the head of a slot of a list created with eo_list_NewContiguous(). the item follows it
+                at offset EOlist::itemoffset, and an EOlistIter of such a list points to its slot.
+ **/ 
+typedef struct
+{
+    uint16_t    prev;               /*< index of previous slot or eo_list_noslot       */
+    uint16_t    next;               /*< index of next slot or eo_list_noslot           */
+} eOlist_slot_t;
+
+
 /* @struct     EOlist_hid
     @brief      hidden definition. implements private data used only internally by the 
                 public or private (static) functions of the list object
@@ -75,6 +87,9 @@ struct EOlist_hid
     eOres_fp_voidp_voidp_t      item_copy_fn;           /*< copy constructor used on inserted data         */ 
     eOres_fp_voidp_t            item_clear_fn;             /*< destructor used on removed data                */ 
     EOlistIter                  *freeiters;             /*< pool of free iterators for the list            */
+    uint8_t                     *slots;                 /*< the slots of eo_list_NewContiguous() or NULL   */
+    uint16_t                    slotsize;               /*< size of a slot: the eOlist_slot_t and the item */
+    uint16_t                    itemoffset;             /*< position of the item inside a slot             */
 };
 
  
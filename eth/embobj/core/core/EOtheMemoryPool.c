@@ -20,12 +20,17 @@
 // - external dependencies
 // --------------------------------------------------------------------------------------------------------------------
 
+// the functions in here are never redirected to their eo_mempool_profile_*() versions
+#define EO_MEMPOOL_PROFILING_IMPLEMENTATION
+
 #include "stdlib.h"
 #include "stdio.h"
+#include "stdarg.h"
 #include "string.h"
 #include "EoCommon.h"
 #include "EOtheErrorManager.h"
 #include "EOVmutex.h"
+#include "EOVtheSystem.h"
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -62,7 +67,49 @@ const eOmempool_cfg_t eom_mempool_DefaultCfg =
 // --------------------------------------------------------------------------------------------------------------------
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// in eo_mempool_alloc_slab mode every block is preceded by this header, so that eo_mempool_Delete() finds its list in O(1).
+// its size keeps the 8-byte alignment of the blocks
+typedef struct
+{
+    uint32_t    sizeclass;      // the index of the free list, or eo_mempool_slab_classes if the block comes directly from the heap
+    uint32_t    size;           // the bytes of the block, header included, as counted in the stats
+} eOmempool_slab_header_t;
+
+typedef struct
+{
+    eOmempool_slab_header_t*    head[eo_mempool_slab_classes];
+    uint16_t                    number[eo_mempool_slab_classes];
+} eOmempool_slab_threadcache_t;
+
+#if defined(EO_MEMPOOL_PROFILING)
+
+typedef struct
+{
+    const void*     ptr;
+    uint32_t        size;
+    uint16_t        site;
+} eOmempool_profile_live_t;
+
+typedef struct
+{
+    eOmempool_profile_site_t    sites[EO_MEMPOOL_PROFILING_SITES];      // the first one collects the sites which do not fit
+    eOmempool_profile_site_t    types[EO_MEMPOOL_PROFILING_SITES];      // the same accounting summed by file
+    uint16_t                    typeofsite[EO_MEMPOOL_PROFILING_SITES];
+    eOmempool_profile_live_t    live[EO_MEMPOOL_PROFILING_LIVEPOINTERS];
+    eOmempool_profile_mark_t    marks[EO_MEMPOOL_PROFILING_MARKS];
+    uint16_t                    marksnumber;
+    uint16_t                    marksnext;
+    uint32_t                    allocations;
+    uint32_t                    deletions;
+    uint32_t                    untracked;      // the allocations which did not fit in live and the deletions not found in it
+    uint32_t                    livebytes;
+    uint32_t                    peak;
+    uint32_t                    lastmark;
+    volatile uint32_t           lock;
+} eOmempool_profile_t;
+
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -71,6 +118,40 @@ const eOmempool_cfg_t eom_mempool_DefaultCfg =
 
 static void * s_eo_mempool_get_static(eOmempool_alignment_t alignmode, uint16_t size, uint16_t number, uint32_t* usedbytes);
 
+static void * s_eo_mempool_arena_get(eOmempool_arena_t *arena, uint32_t size);
+
+static void * s_eo_mempool_slab_get(uint32_t size);
+
+static void s_eo_mempool_slab_release(void *m);
+
+static void * s_eo_mempool_slab_realloc(void *m, uint32_t size);
+
+static eOmempool_slab_header_t * s_eo_mempool_slab_refill(uint8_t sizeclass);
+
+static void s_eo_mempool_slab_lock(void);
+
+static void s_eo_mempool_slab_unlock(void);
+
+static void s_eo_mempool_stats_change(uint32_t *value, uint32_t add, uint32_t sub);
+
+#if defined(EO_MEMPOOL_PROFILING)
+static void s_eo_mempool_profile_alloc(const void *m, uint32_t size, const char *file, uint32_t line);
+
+static void s_eo_mempool_profile_delete(const void *m);
+
+static uint16_t s_eo_mempool_profile_site(const char *file, uint32_t line);
+
+static uint32_t s_eo_mempool_profile_hash(const void *m);
+
+static void s_eo_mempool_profile_lock(void);
+
+static void s_eo_mempool_profile_unlock(void);
+
+static const char * s_eo_mempool_profile_basename(const char *file);
+
+static uint32_t s_eo_mempool_profile_print(char *buffer, uint32_t size, uint32_t n, const char *format, ...);
+#endif
+
 static void * s_memallocator(uint32_t s);
 
 static void s_memfree(void *p);
@@ -87,6 +168,18 @@ static void * s_memrealloc(void *p, uint32_t s);
 
 static const char s_eobj_ownname[] = "EOtheMemoryPool";
 
+// the arena active in the calling thread
+static EO_thread_local eOmempool_arena_t * s_eo_mempool_arena = NULL;
+
+#if defined(EO_THREAD_LOCAL_AVAILABLE)
+// the free blocks kept by the calling thread in eo_mempool_alloc_slab mode
+static EO_thread_local eOmempool_slab_threadcache_t s_eo_mempool_slab_threadcache;
+#endif
+
+#if defined(EO_MEMPOOL_PROFILING)
+static eOmempool_profile_t s_eo_mempool_profile;
+#endif
+
 
 static EOtheMemoryPool s_the_mempool = 
 { 
@@ -130,6 +223,12 @@ static EOtheMemoryPool s_the_mempool =
     {
         EO_INIT(.usedbytesheap)     0,
         EO_INIT(.usedbytespool)     0
+    },
+    EO_INIT(.theslab)
+    {
+        EO_INIT(.freelist)              {NULL},
+        EO_INIT(.threadcachecapacity)   0,
+        EO_INIT(.lock)                  0
     }
 };
 
@@ -182,6 +281,18 @@ extern EOtheMemoryPool * eo_mempool_Initialise(const eOmempool_cfg_t *cfg)
             
         } break;
         
+        case eo_mempool_alloc_slab:
+        {
+            if(NULL != cfg->conf)
+            {   // the heap functions refill the free lists and serve the requests bigger than the biggest block
+                s_the_mempool.theheap.allocate      =   cfg->conf->heap.allocate;
+                s_the_mempool.theheap.reallocate    =   cfg->conf->heap.reallocate;
+                s_the_mempool.theheap.release       =   cfg->conf->heap.release;
+                s_the_mempool.theslab.threadcachecapacity = cfg->conf->slab.threadcachecapacity;
+            }
+            
+        } break;
+        
         case eo_mempool_alloc_static:
         case eo_mempool_alloc_mixed:
         {               
@@ -290,6 +401,15 @@ extern void * eo_mempool_GetMemory(EOtheMemoryPool *p, eOmempool_alignment_t ali
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eo_mempool_GetMemory() is asked 0 bytes", s_eobj_ownname, &errdes);        
         return(NULL);
     }
+    
+    if(NULL != s_eo_mempool_arena)
+    {   // the arena gives 8-byte alignment, so it is ok for every alignmode
+        ret = s_eo_mempool_arena_get(s_eo_mempool_arena, (uint32_t)size*number);
+        if(NULL != ret)
+        {
+            return(ret);
+        }
+    }
    
 
     if(NULL == p)
@@ -334,6 +454,11 @@ extern void * eo_mempool_GetMemory(EOtheMemoryPool *p, eOmempool_alignment_t ali
             //size = s_align_size(alignmode, size);  // alignment is internal to s_eo_mempool_get_static()
             ret = s_eo_mempool_get_static(alignmode, size, number, &usedbytespool);
         } break;
+        
+        case eo_mempool_alloc_slab:
+        {   // the blocks are 8-byte aligned. the stats are updated inside
+            ret = s_eo_mempool_slab_get((uint32_t)size*number);
+        } break;
     
     }
     
@@ -347,8 +472,11 @@ extern void * eo_mempool_GetMemory(EOtheMemoryPool *p, eOmempool_alignment_t ali
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_GetMemory() no more memory", s_eobj_ownname, &errdes);
     }
     
-    s_the_mempool.stats.usedbytespool += usedbytespool; 
-    s_the_mempool.stats.usedbytesheap += usedbytesheap;
+    if(eo_mempool_alloc_slab != mode)
+    {   // in slab mode they are already updated with atomic operations
+        s_the_mempool.stats.usedbytespool += usedbytespool; 
+        s_eo_mempool_stats_change(&s_the_mempool.stats.usedbytesheap, usedbytesheap, 0);
+    }
     
     return(ret);   
 }
@@ -365,9 +493,36 @@ extern eOmempool_alloc_mode_t eo_mempool_alloc_mode_Get(EOtheMemoryPool *p)
 }
 
 
+extern eObool_t eo_mempool_IsDeleteSupported(EOtheMemoryPool *p)
+{
+    eOmempool_alloc_mode_t mode = s_the_mempool.config.mode;
+    p = p;
+    return(((eo_mempool_alloc_dynamic == mode) || (eo_mempool_alloc_slab == mode)) ? (eobool_true) : (eobool_false));
+}
+
+
 extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size)
 {
-    void *ret = s_the_mempool.theheap.allocate(size);
+    void *ret = NULL;
+    
+    if((NULL != s_eo_mempool_arena) && (0 != size))
+    {
+        ret = s_eo_mempool_arena_get(s_eo_mempool_arena, size);
+        if(NULL != ret)
+        {
+            return(ret);
+        }
+    }
+    
+    if(eo_mempool_alloc_slab == s_the_mempool.config.mode)
+    {
+        ret = (0 == size) ? (NULL) : (s_eo_mempool_slab_get(size));
+    }
+    else
+    {
+        ret = s_the_mempool.theheap.allocate(size);
+        s_eo_mempool_stats_change(&s_the_mempool.stats.usedbytesheap, eo_common_msize(ret), 0);
+    }
 
     if(NULL == ret)
     {   // manage the fatal error in case memory could not be achieved
@@ -378,8 +533,6 @@ extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size)
         errdes.sourceaddress    = 0; 
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_New() no more memory", s_eobj_ownname, &errdes);
     }
-    
-    s_the_mempool.stats.usedbytesheap += eo_common_msize(ret);      
 
     return(ret);   
 }
@@ -395,7 +548,7 @@ extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size)
     }
     
     
-    if(eo_mempool_alloc_dynamic != s_the_mempool.config.mode)
+    if(eobool_false == eo_mempool_IsDeleteSupported(p))
     {
         eOerrmanDescriptor_t errdes = {0};
         errdes.code             = eo_errman_code_sys_wrongusage;
@@ -407,12 +560,18 @@ extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size)
         return(NULL);
     }            
     
-    if(NULL != m)
+    if(eo_mempool_alloc_slab == s_the_mempool.config.mode)
+    {   // the stats are updated inside
+        ret = (NULL == m) ? (s_eo_mempool_slab_get(size)) : (s_eo_mempool_slab_realloc(m, size));
+    }
+    else
     {
-        s_the_mempool.stats.usedbytesheap -= eo_common_msize(m); 
-    }    
-    
-    ret = s_the_mempool.theheap.reallocate(m, size);
+        uint32_t prevsize = (NULL != m) ? (eo_common_msize(m)) : (0);
+        
+        ret = s_the_mempool.theheap.reallocate(m, size);
+        
+        s_eo_mempool_stats_change(&s_the_mempool.stats.usedbytesheap, eo_common_msize(ret), prevsize);
+    }
     
     if(NULL == ret)
     {   // manage the fatal error in case memory could not be achieved
@@ -424,8 +583,6 @@ extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size)
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_Realloc() no more memory", s_eobj_ownname, &errdes);
     }
     
-    s_the_mempool.stats.usedbytesheap += eo_common_msize(ret);  
-    
     return(ret);   
 }
 
@@ -437,18 +594,258 @@ extern void eo_mempool_Delete(EOtheMemoryPool *p, void *m)
         return;
     }
     
+    if((NULL != s_eo_mempool_arena) && ((uint8_t*)m >= s_eo_mempool_arena->data) && ((uint8_t*)m < (s_eo_mempool_arena->data + s_eo_mempool_arena->capacity)))
+    {   // it is released all together with eo_mempool_Arena_Release()
+        return;
+    }
+    
+    if(eo_mempool_alloc_slab == s_the_mempool.config.mode)
+    {
+        s_eo_mempool_slab_release(m);
+        return;
+    }
+    
     if(eo_mempool_alloc_dynamic != s_the_mempool.config.mode)
     {        
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eo_mempool_Delete(): only w/ eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);       
         return;
     }        
         
-    s_the_mempool.stats.usedbytesheap -= eo_common_msize(m); 
+    s_eo_mempool_stats_change(&s_the_mempool.stats.usedbytesheap, 0, eo_common_msize(m)); 
 
     s_the_mempool.theheap.release(m);          
 }
 
 
+extern eOresult_t eo_mempool_Arena_Init(EOtheMemoryPool *p, eOmempool_arena_t *arena, uint32_t capacity)
+{
+    if((NULL == arena) || (0 == capacity))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    capacity = (capacity + 7) & ~((uint32_t)7);
+    
+    arena->used     = 0;
+    arena->overflow = 0;
+    arena->capacity = 0;
+    arena->data     = NULL;
+    
+    if(eobool_true == eo_mempool_IsDeleteSupported(p))
+    {
+        arena->data = (uint8_t*) eo_mempool_New(p, capacity);
+    }
+    else if((capacity/8) <= EO_UINT16_MAX)
+    {
+        arena->data = (uint8_t*) eo_mempool_GetMemory(p, eo_mempool_align_64bit, 8, (uint16_t)(capacity/8));
+    }
+    
+    if(NULL == arena->data)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    arena->capacity = capacity;
+    
+    return(eores_OK);
+}
+
+
+extern eOmempool_arena_t * eo_mempool_Arena_Activate(EOtheMemoryPool *p, eOmempool_arena_t *arena)
+{
+    eOmempool_arena_t *prev = s_eo_mempool_arena;
+    
+    p = p;
+    
+    s_eo_mempool_arena = arena;
+    
+    return(prev);
+}
+
+
+extern void eo_mempool_Arena_Release(EOtheMemoryPool *p, eOmempool_arena_t *arena)
+{
+    if((NULL == arena) || (NULL == arena->data))
+    {
+        return;
+    }
+    
+    if(arena == s_eo_mempool_arena)
+    {
+        s_eo_mempool_arena = NULL;
+    }
+    
+    if(eobool_true == eo_mempool_IsDeleteSupported(p))
+    {
+        eo_mempool_Delete(p, arena->data);
+    }
+    
+    arena->data     = NULL;
+    arena->capacity = 0;
+    arena->used     = 0;
+}
+
+
+extern eOresult_t eo_mempool_profile_Sites_Get(EOtheMemoryPool *p, const eOmempool_profile_site_t **sites, uint16_t *number)
+{
+#if defined(EO_MEMPOOL_PROFILING)
+    p = p;
+    
+    if((NULL == sites) || (NULL == number))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    *sites  = s_eo_mempool_profile.sites;
+    *number = EO_MEMPOOL_PROFILING_SITES;
+    
+    return(eores_OK);
+#else
+    p = p; sites = sites; number = number;
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
+extern eOresult_t eo_mempool_profile_Marks_Get(EOtheMemoryPool *p, eOmempool_profile_mark_t *marks, uint16_t capacity, uint16_t *number)
+{
+#if defined(EO_MEMPOOL_PROFILING)
+    eOmempool_profile_t *prof = &s_eo_mempool_profile;
+    uint16_t first = 0;
+    uint16_t i = 0;
+    
+    p = p;
+    
+    if((NULL == marks) || (NULL == number))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    s_eo_mempool_profile_lock();
+    
+    *number = (capacity < prof->marksnumber) ? (capacity) : (prof->marksnumber);
+    // the oldest of the ones we copy
+    first = (uint16_t)((prof->marksnext + EO_MEMPOOL_PROFILING_MARKS - *number) % EO_MEMPOOL_PROFILING_MARKS);
+    for(i=0; i<*number; i++)
+    {
+        marks[i] = prof->marks[(first + i) % EO_MEMPOOL_PROFILING_MARKS];
+    }
+    
+    s_eo_mempool_profile_unlock();
+    
+    return(eores_OK);
+#else
+    p = p; marks = marks; capacity = capacity; number = number;
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
+extern uint32_t eo_mempool_profile_Dump(EOtheMemoryPool *p, char *buffer, uint32_t size)
+{
+#if defined(EO_MEMPOOL_PROFILING)
+    eOmempool_profile_t *prof = &s_eo_mempool_profile;
+    const eOmempool_profile_site_t *s = NULL;
+    uint32_t n = 0;
+    uint16_t i = 0;
+    
+    p = p;
+    
+    if((NULL == buffer) || (0 == size))
+    {
+        return(0);
+    }
+    
+    buffer[0] = 0;
+    
+    s_eo_mempool_profile_lock();
+    
+    n = s_eo_mempool_profile_print(buffer, size, n, "mempool: live %u peak %u allocations %u deletions %u untracked %u\n", 
+                                   prof->livebytes, prof->peak, prof->allocations, prof->deletions, prof->untracked);
+    
+    for(i=0; i<EO_MEMPOOL_PROFILING_SITES; i++)
+    {
+        s = &prof->types[i];
+        if(NULL != s->file)
+        {
+            n = s_eo_mempool_profile_print(buffer, size, n, "type %s: allocations %u deletions %u bytes %u live %u peak %u\n",
+                                           s_eo_mempool_profile_basename(s->file), s->allocations, s->deletions, s->bytes, s->live, s->peak);
+        }
+    }
+    
+    for(i=0; i<EO_MEMPOOL_PROFILING_SITES; i++)
+    {
+        s = &prof->sites[i];
+        if((0 == i) && (0 != s->allocations))
+        {
+            n = s_eo_mempool_profile_print(buffer, size, n, "site others: allocations %u deletions %u bytes %u live %u peak %u\n",
+                                           s->allocations, s->deletions, s->bytes, s->live, s->peak);
+        }
+        else if(NULL != s->file)
+        {
+            n = s_eo_mempool_profile_print(buffer, size, n, "site %s:%u: allocations %u deletions %u bytes %u live %u peak %u\n",
+                                           s_eo_mempool_profile_basename(s->file), s->line, s->allocations, s->deletions, s->bytes, s->live, s->peak);
+        }
+    }
+    
+    for(i=0; i<prof->marksnumber; i++)
+    {
+        const eOmempool_profile_mark_t *m = &prof->marks[(prof->marksnext + EO_MEMPOOL_PROFILING_MARKS - prof->marksnumber + i) % EO_MEMPOOL_PROFILING_MARKS];
+        n = s_eo_mempool_profile_print(buffer, size, n, "mark time %u ms allocations %u live %u\n", (uint32_t)(m->time/1000), m->allocations, m->live);
+    }
+    
+    s_eo_mempool_profile_unlock();
+    
+    return(n);
+#else
+    p = p; buffer = buffer; size = size;
+    return(0);
+#endif
+}
+
+
+#if defined(EO_MEMPOOL_PROFILING)
+
+extern void * eo_mempool_profile_GetMemory(EOtheMemoryPool *p, eOmempool_alignment_t alignmode, uint16_t size, uint16_t number, const char *file, uint32_t line)
+{
+    void *ret = eo_mempool_GetMemory(p, alignmode, size, number);
+    s_eo_mempool_profile_alloc(ret, (uint32_t)size*number, file, line);
+    return(ret);
+}
+
+
+extern void * eo_mempool_profile_New(EOtheMemoryPool *p, uint32_t size, const char *file, uint32_t line)
+{
+    void *ret = eo_mempool_New(p, size);
+    s_eo_mempool_profile_alloc(ret, size, file, line);
+    return(ret);
+}
+
+
+extern void * eo_mempool_profile_Realloc(EOtheMemoryPool *p, void *m, uint32_t size, const char *file, uint32_t line)
+{
+    void *ret = NULL;
+    
+    s_eo_mempool_profile_delete(m);
+    ret = eo_mempool_Realloc(p, m, size);
+    s_eo_mempool_profile_alloc(ret, size, file, line);
+    
+    return(ret);
+}
+
+
+extern void eo_mempool_profile_Delete(EOtheMemoryPool *p, void *m)
+{
+    if((eobool_true == eo_mempool_IsDeleteSupported(p)) || (NULL != s_eo_mempool_arena))
+    {   // otherwise eo_mempool_Delete() does not release anything
+        s_eo_mempool_profile_delete(m);
+    }
+    eo_mempool_Delete(p, m);
+}
+
+#endif
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -551,6 +948,476 @@ static void * s_eo_mempool_get_static(eOmempool_alignment_t alignmode, uint16_t
     return(ret);
 }
 
+static void * s_eo_mempool_arena_get(eOmempool_arena_t *arena, uint32_t size)
+{
+    void *ret = NULL;
+    
+    size = (size + 7) & ~((uint32_t)7);
+    
+    if((arena->used + size) > arena->capacity)
+    {
+        arena->overflow += size;
+        return(NULL);
+    }
+    
+    ret = &arena->data[arena->used];
+    arena->used += size;
+    
+    // the objects expect zeroed memory as the one given by calloc()
+    memset(ret, 0, size);
+    
+    return(ret);
+}
+
+static void * s_eo_mempool_slab_get(uint32_t size)
+{
+    eOmempool_slab_header_t *h = NULL;
+    uint8_t sizeclass = 0;
+    uint32_t sizeofblock = eo_mempool_slab_minblocksize;
+    
+    while((sizeclass < eo_mempool_slab_classes) && ((size + sizeof(eOmempool_slab_header_t)) > sizeofblock))
+    {
+        sizeclass++;
+        sizeofblock <<= 1;
+    }
+    
+    if(eo_mempool_slab_classes == sizeclass)
+    {   // bigger than the biggest block: it comes directly from the heap
+        h = (eOmempool_slab_header_t*) s_the_mempool.theheap.allocate(size + sizeof(eOmempool_slab_header_t));
+        if(NULL == h)
+        {
+            return(NULL);
+        }
+        h->sizeclass    = eo_mempool_slab_classes;
+        h->size         = size + sizeof(eOmempool_slab_header_t);
+        s_eo_mempool_stats_change(&s_the_mempool.stats.usedbytesheap, h->size, 0);
+        return(&h[1]);
+    }
+    
+#if defined(EO_THREAD_LOCAL_AVAILABLE)
+    if(0 != s_eo_mempool_slab_threadcache.number[sizeclass])
+    {   // from the cache of the thread: no lock 
+        h = s_eo_mempool_slab_threadcache.head[sizeclass];
+        s_eo_mempool_slab_threadcache.head[sizeclass] = *((eOmempool_slab_header_t**)&h[1]);
+        s_eo_mempool_slab_threadcache.number[sizeclass]--;
+    }
+#endif
+    
+    if(NULL == h)
+    {
+        s_eo_mempool_slab_lock();
+        h = (eOmempool_slab_header_t*) s_the_mempool.theslab.freelist[sizeclass];
+        if(NULL != h)
+        {
+            s_the_mempool.theslab.freelist[sizeclass] = *((void**)&h[1]);
+        }
+        s_eo_mempool_slab_unlock();
+    }
+    
+    if(NULL == h)
+    {
+        h = s_eo_mempool_slab_refill(sizeclass);
+        if(NULL == h)
+        {
+            return(NULL);
+        }
+    }
+    
+    h->sizeclass    = sizeclass;
+    h->size         = sizeofblock;
+    // the objects expect zeroed memory as the one given by calloc()
+    memset(&h[1], 0, sizeofblock - sizeof(eOmempool_slab_header_t));
+    s_eo_mempool_stats_change(&s_the_mempool.stats.usedbytespool, sizeofblock, 0);
+    
+    return(&h[1]);
+}
+
+
+static void s_eo_mempool_slab_release(void *m)
+{
+    eOmempool_slab_header_t *h = ((eOmempool_slab_header_t*)m) - 1;
+    uint8_t sizeclass = (uint8_t)h->sizeclass;
+    
+    if(eo_mempool_slab_classes == sizeclass)
+    {
+        s_eo_mempool_stats_change(&s_the_mempool.stats.usedbytesheap, 0, h->size);
+        s_the_mempool.theheap.release(h);
+        return;
+    }
+    
+    s_eo_mempool_stats_change(&s_the_mempool.stats.usedbytespool, 0, h->size);
+    
+#if defined(EO_THREAD_LOCAL_AVAILABLE)
+    if(s_eo_mempool_slab_threadcache.number[sizeclass] < s_the_mempool.theslab.threadcachecapacity)
+    {
+        *((eOmempool_slab_header_t**)m) = s_eo_mempool_slab_threadcache.head[sizeclass];
+        s_eo_mempool_slab_threadcache.head[sizeclass] = h;
+        s_eo_mempool_slab_threadcache.number[sizeclass]++;
+        return;
+    }
+#endif
+    
+    s_eo_mempool_slab_lock();
+    *((void**)m) = s_the_mempool.theslab.freelist[sizeclass];
+    s_the_mempool.theslab.freelist[sizeclass] = h;
+    s_eo_mempool_slab_unlock();
+}
+
+
+static void * s_eo_mempool_slab_realloc(void *m, uint32_t size)
+{
+    eOmempool_slab_header_t *h = ((eOmempool_slab_header_t*)m) - 1;
+    void *ret = NULL;
+    
+    if(eo_mempool_slab_classes == h->sizeclass)
+    {   // it stays in the heap
+        uint32_t prevsize = h->size;
+        h = (eOmempool_slab_header_t*) s_the_mempool.theheap.reallocate(h, size + sizeof(eOmempool_slab_header_t));
+        if(NULL == h)
+        {
+            return(NULL);
+        }
+        h->size = size + sizeof(eOmempool_slab_header_t);
+        s_eo_mempool_stats_change(&s_the_mempool.stats.usedbytesheap, h->size, prevsize);
+        return(&h[1]);
+    }
+    
+    if((size + sizeof(eOmempool_slab_header_t)) <= h->size)
+    {   // it still fits in its block
+        return(m);
+    }
+    
+    ret = s_eo_mempool_slab_get(size);
+    if(NULL != ret)
+    {
+        memcpy(ret, m, h->size - sizeof(eOmempool_slab_header_t));
+        s_eo_mempool_slab_release(m);
+    }
+    
+    return(ret);
+}
+
+
+static eOmempool_slab_header_t * s_eo_mempool_slab_refill(uint8_t sizeclass)
+{   // it takes from the heap a chunk of at least four blocks, keeps the first and puts the others in the free list
+    uint32_t sizeofblock = (uint32_t)eo_mempool_slab_minblocksize << sizeclass;
+    uint32_t number = eo_mempool_slab_minchunksize / sizeofblock;
+    uint8_t *chunk = NULL;
+    uint32_t i = 0;
+    
+    if(number < 4)
+    {
+        number = 4;
+    }
+    
+    chunk = (uint8_t*) s_the_mempool.theheap.allocate(number * sizeofblock);
+    if(NULL == chunk)
+    {
+        return(NULL);
+    }
+    
+    for(i=1; i<number-1; i++)
+    {   // links the blocks from 1 to number-1 among themselves
+        *((void**)&chunk[i*sizeofblock + sizeof(eOmempool_slab_header_t)]) = &chunk[(i+1)*sizeofblock];
+    }
+    
+    s_eo_mempool_slab_lock();
+    *((void**)&chunk[(number-1)*sizeofblock + sizeof(eOmempool_slab_header_t)]) = s_the_mempool.theslab.freelist[sizeclass];
+    s_the_mempool.theslab.freelist[sizeclass] = &chunk[sizeofblock];
+    s_eo_mempool_slab_unlock();
+    
+    return((eOmempool_slab_header_t*)chunk);
+}
+
+
+static void s_eo_mempool_slab_lock(void)
+{
+#if defined(EO_ATOMIC_AVAILABLE)
+    while(!EO_atomic_cas32(&s_the_mempool.theslab.lock, 0, 1))
+    {
+        ;
+    }
+#else
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+#endif
+}
+
+
+static void s_eo_mempool_slab_unlock(void)
+{
+#if defined(EO_ATOMIC_AVAILABLE)
+    EO_atomic_barrier();
+    s_the_mempool.theslab.lock = 0;
+#else
+    eov_mutex_Release(s_the_mempool.mutex);
+#endif
+}
+
+
+static void s_eo_mempool_stats_change(uint32_t *value, uint32_t add, uint32_t sub)
+{   // the slab and the dynamic modes can be used by several threads at the same time
+#if defined(EO_ATOMIC_AVAILABLE)
+    uint32_t prev = 0;
+    do
+    {
+        prev = *((volatile uint32_t*)value);
+    } while(!EO_atomic_cas32(value, prev, prev + add - sub));
+#else
+    *value = *value + add - sub;
+#endif
+}
+
+#if defined(EO_MEMPOOL_PROFILING)
+
+static void s_eo_mempool_profile_alloc(const void *m, uint32_t size, const char *file, uint32_t line)
+{
+    eOmempool_profile_t *prof = &s_eo_mempool_profile;
+    eOmempool_profile_site_t *site = NULL;
+    eOmempool_profile_site_t *type = NULL;
+    uint32_t i = 0;
+    uint32_t k = 0;
+    uint16_t s = 0;
+    
+    if(NULL == m)
+    {
+        return;
+    }
+    
+    s_eo_mempool_profile_lock();
+    
+    s = s_eo_mempool_profile_site(file, line);
+    site = &prof->sites[s];
+    type = &prof->types[prof->typeofsite[s]];
+    
+    site->allocations++;
+    site->bytes += size;
+    site->live += size;
+    site->peak = (site->live > site->peak) ? (site->live) : (site->peak);
+    type->allocations++;
+    type->bytes += size;
+    type->live += size;
+    type->peak = (type->live > type->peak) ? (type->live) : (type->peak);
+    
+    prof->allocations++;
+    prof->livebytes += size;
+    if(prof->livebytes > prof->peak)
+    {
+        prof->peak = prof->livebytes;
+        if((prof->peak - prof->lastmark) >= EO_MEMPOOL_PROFILING_MARKSTEP)
+        {
+            eOmempool_profile_mark_t *mark = &prof->marks[prof->marksnext];
+            mark->time          = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+            mark->allocations   = prof->allocations;
+            mark->live          = prof->peak;
+            prof->marksnext     = (prof->marksnext + 1) % EO_MEMPOOL_PROFILING_MARKS;
+            prof->marksnumber   = (prof->marksnumber < EO_MEMPOOL_PROFILING_MARKS) ? (prof->marksnumber + 1) : (prof->marksnumber);
+            prof->lastmark      = prof->peak;
+        }
+    }
+    
+    // we remember the pointer so that its deletion is given back to its site
+    i = s_eo_mempool_profile_hash(m);
+    for(k=0; k<EO_MEMPOOL_PROFILING_LIVEPOINTERS; k++)
+    {
+        if(NULL == prof->live[i].ptr)
+        {
+            prof->live[i].ptr   = m;
+            prof->live[i].size  = size;
+            prof->live[i].site  = s;
+            break;
+        }
+        i = (i + 1) & (EO_MEMPOOL_PROFILING_LIVEPOINTERS - 1);
+    }
+    if(EO_MEMPOOL_PROFILING_LIVEPOINTERS == k)
+    {
+        prof->untracked++;
+    }
+    
+    s_eo_mempool_profile_unlock();
+}
+
+
+static void s_eo_mempool_profile_delete(const void *m)
+{
+    eOmempool_profile_t *prof = &s_eo_mempool_profile;
+    uint32_t i = 0;
+    uint32_t j = 0;
+    uint32_t h = 0;
+    uint32_t k = 0;
+    
+    if(NULL == m)
+    {
+        return;
+    }
+    
+    s_eo_mempool_profile_lock();
+    
+    i = s_eo_mempool_profile_hash(m);
+    for(k=0; k<EO_MEMPOOL_PROFILING_LIVEPOINTERS; k++)
+    {
+        if((NULL == prof->live[i].ptr) || (m == prof->live[i].ptr))
+        {
+            break;
+        }
+        i = (i + 1) & (EO_MEMPOOL_PROFILING_LIVEPOINTERS - 1);
+    }
+    
+    if((EO_MEMPOOL_PROFILING_LIVEPOINTERS == k) || (NULL == prof->live[i].ptr))
+    {
+        prof->untracked++;
+        s_eo_mempool_profile_unlock();
+        return;
+    }
+    
+    {
+        eOmempool_profile_site_t *site = &prof->sites[prof->live[i].site];
+        eOmempool_profile_site_t *type = &prof->types[prof->typeofsite[prof->live[i].site]];
+        uint32_t size = prof->live[i].size;
+        site->deletions++;
+        site->live -= size;
+        type->deletions++;
+        type->live -= size;
+        prof->deletions++;
+        prof->livebytes -= size;
+    }
+    
+    // removal with backward shift, so that the linear probing does not need tombstones
+    j = i;
+    for(;;)
+    {
+        j = (j + 1) & (EO_MEMPOOL_PROFILING_LIVEPOINTERS - 1);
+        if(NULL == prof->live[j].ptr)
+        {
+            break;
+        }
+        h = s_eo_mempool_profile_hash(prof->live[j].ptr);
+        // the entry in j stays where it is if its home h is cyclically inside (i, j]
+        if((i <= j) ? ((i < h) && (h <= j)) : ((i < h) || (h <= j)))
+        {
+            continue;
+        }
+        prof->live[i] = prof->live[j];
+        i = j;
+    }
+    prof->live[i].ptr = NULL;
+    
+    s_eo_mempool_profile_unlock();
+}
+
+
+static uint16_t s_eo_mempool_profile_site(const char *file, uint32_t line)
+{   // the site 0 collects those which do not fit. the same file may have more than one pointer, hence the strcmp()
+    eOmempool_profile_t *prof = &s_eo_mempool_profile;
+    const uint16_t n = EO_MEMPOOL_PROFILING_SITES - 1;
+    uint16_t i = (uint16_t)(((line * 2654435761u) >> 16) % n);
+    uint16_t k = 0;
+    uint16_t t = 0;
+    
+    for(k=0; k<n; k++)
+    {
+        eOmempool_profile_site_t *site = &prof->sites[1+i];
+        if((NULL != site->file) && (line == site->line) && (0 == strcmp(file, site->file)))
+        {
+            return(1+i);
+        }
+        if(NULL == site->file)
+        {   // a new site: we also look for its type
+            site->file = file;
+            site->line = line;
+            for(t=0; t<EO_MEMPOOL_PROFILING_SITES; t++)
+            {
+                if(NULL == prof->types[t].file)
+                {
+                    prof->types[t].file = file;
+                    break;
+                }
+                if(0 == strcmp(file, prof->types[t].file))
+                {
+                    break;
+                }
+            }
+            prof->typeofsite[1+i] = t;
+            return(1+i);
+        }
+        i = (i + 1) % n;
+    }
+    
+    return(0);
+}
+
+
+static uint32_t s_eo_mempool_profile_hash(const void *m)
+{
+    return((((uint32_t)((uintptr_t)m >> 3)) * 2654435761u) & (EO_MEMPOOL_PROFILING_LIVEPOINTERS - 1));
+}
+
+
+static void s_eo_mempool_profile_lock(void)
+{
+#if defined(EO_ATOMIC_AVAILABLE)
+    while(!EO_atomic_cas32(&s_eo_mempool_profile.lock, 0, 1))
+    {
+        ;
+    }
+#else
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+#endif
+}
+
+
+static void s_eo_mempool_profile_unlock(void)
+{
+#if defined(EO_ATOMIC_AVAILABLE)
+    EO_atomic_barrier();
+    s_eo_mempool_profile.lock = 0;
+#else
+    eov_mutex_Release(s_the_mempool.mutex);
+#endif
+}
+
+
+static const char * s_eo_mempool_profile_basename(const char *file)
+{
+    const char *ret = file;
+    
+    for(; 0 != *file; file++)
+    {
+        if(('/' == *file) || ('\\' == *file))
+        {
+            ret = file + 1;
+        }
+    }
+    
+    return(ret);
+}
+
+
+static uint32_t s_eo_mempool_profile_print(char *buffer, uint32_t size, uint32_t n, const char *format, ...)
+{   // it appends to buffer and never goes beyond size-1 chars
+    va_list ap;
+    int r = 0;
+    
+    if(n >= (size - 1))
+    {
+        return(n);
+    }
+    
+    va_start(ap, format);
+    r = vsnprintf(&buffer[n], size - n, format, ap);
+    va_end(ap);
+    
+    if(r < 0)
+    {
+        return(n);
+    }
+    
+    n += (uint32_t)r;
+    
+    return((n > (size - 1)) ? (size - 1) : (n));
+}
+
+#endif
+
 static void * s_memallocator(uint32_t s)
 {
     return(calloc(s, 1));
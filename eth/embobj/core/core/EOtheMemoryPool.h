@@ -59,7 +59,25 @@ extern "C" {
 
 
 // - public #define  --------------------------------------------------------------------------------------------------
-// empty-section
+
+// if EO_MEMPOOL_PROFILING is defined for the whole build, eo_mempool_GetMemory(), eo_mempool_New(), eo_mempool_Realloc() and
+// eo_mempool_Delete() are redirected to the eo_mempool_profile_*() functions, which account every call by its source file and line. 
+// the source file is also the object type (e.g., EOlist.c or EOropframe.c). if it is not defined, there is no code and no memory. 
+// the sizes of the tables can be redefined in the build.
+#if defined(EO_MEMPOOL_PROFILING)
+    #if !defined(EO_MEMPOOL_PROFILING_SITES)
+        #define EO_MEMPOOL_PROFILING_SITES          128     // the max number of call sites. the first one collects the sites which do not fit
+    #endif
+    #if !defined(EO_MEMPOOL_PROFILING_LIVEPOINTERS)
+        #define EO_MEMPOOL_PROFILING_LIVEPOINTERS   4096    // the max number of live pointers it tracks. it must be a power of two
+    #endif
+    #if !defined(EO_MEMPOOL_PROFILING_MARKS)
+        #define EO_MEMPOOL_PROFILING_MARKS          64      // the number of the last high water marks which are kept
+    #endif
+    #if !defined(EO_MEMPOOL_PROFILING_MARKSTEP)
+        #define EO_MEMPOOL_PROFILING_MARKSTEP       1024    // a new high water mark is kept when the peak grows by these bytes
+    #endif
+#endif
   
 
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
@@ -80,9 +98,14 @@ typedef enum
 {
     eo_mempool_alloc_dynamic    = 0,
     eo_mempool_alloc_static     = 1,
-    eo_mempool_alloc_mixed      = 2
+    eo_mempool_alloc_mixed      = 2,
+    eo_mempool_alloc_slab       = 3     /**< the memory comes from free lists of blocks of eo_mempool_slab_classes sizes, which are refilled 
+                                             with the heap functions. eo_mempool_Delete() puts a block back into its list in O(1) */
 } eOmempool_alloc_mode_t;
 
+
+enum { eo_mempool_slab_classes = 8, eo_mempool_slab_minblocksize = 32, eo_mempool_slab_minchunksize = 2048 };
+
 typedef struct 
 {
     eOvoidp_fp_uint32_t         allocate;
@@ -103,10 +126,21 @@ typedef struct
     uint64_t*                   data64;    
 } eOmempool_pool_config_t;
 
+/**	@typedef    typedef struct eOmempool_slab_config_t 
+ 	@brief      Contains the configuration of the eo_mempool_alloc_slab mode. 
+ **/ 
+typedef struct 
+{
+    uint16_t                    threadcachecapacity;    /**< the max number of free blocks of each size that every thread keeps for itself, so that 
+                                                             it does not take the lock. 0 disables the caches, which exist only if EO_THREAD_LOCAL_AVAILABLE.
+                                                             the blocks in the cache of a thread which terminates are lost. */
+} eOmempool_slab_config_t;
+
 typedef struct
 {
     eOmempool_pool_config_t     pool;
     eOmempool_heap_config_t     heap;
+    eOmempool_slab_config_t     slab;
 } eOmempool_alloc_config_t;
 
 
@@ -132,6 +166,46 @@ typedef enum
     eo_mempool_align_32bit  = 4,    /**< used with eo_mempool_alloc_static or eo_mempool_alloc_mixed to force 4-bytes alignment */
     eo_mempool_align_64bit  = 8     /**< used with eo_mempool_alloc_static or eo_mempool_alloc_mixed to force 8-bytes alignment */
 } eOmempool_alignment_t;
+
+
+/**	@typedef    typedef struct eOmempool_profile_site_t 
+ 	@brief      Contains the accounting of a call site when EO_MEMPOOL_PROFILING is defined. 
+ **/ 
+typedef struct
+{
+    const char*     file;           /**< the source file of the call site, hence the object type */
+    uint32_t        line;           /**< the line of the call site */
+    uint32_t        allocations;    /**< the number of allocations */
+    uint32_t        deletions;      /**< the number of deletions of memory allocated at this site */
+    uint32_t        bytes;          /**< the total of the requested bytes */
+    uint32_t        live;           /**< the bytes still allocated */
+    uint32_t        peak;           /**< the maximum of live */
+} eOmempool_profile_site_t;
+
+
+/**	@typedef    typedef struct eOmempool_profile_mark_t 
+ 	@brief      Contains a high water mark of the total live bytes when EO_MEMPOOL_PROFILING is defined. 
+ **/ 
+typedef struct
+{
+    eOabstime_t     time;           /**< the life time of the system, or 0 if it is not yet started */
+    uint32_t        allocations;    /**< the number of allocations done so far */
+    uint32_t        live;           /**< the total live bytes, which was a new maximum */
+} eOmempool_profile_mark_t;
+
+
+/**	@typedef    typedef struct eOmempool_arena_t 
+ 	@brief      Contains a block of memory which is carved up sequentially by eo_mempool_GetMemory() and eo_mempool_New() while the 
+                arena is active in the calling thread (see eo_mempool_Arena_Activate()). The requests which do not fit are served as 
+                usual and their bytes are summed in overflow. 
+ **/ 
+typedef struct
+{
+    uint8_t*    data;
+    uint32_t    capacity;
+    uint32_t    used;
+    uint32_t    overflow;
+} eOmempool_arena_t;
    
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
@@ -195,7 +269,10 @@ extern eOresult_t eo_mempool_SetMutex(EOtheMemoryPool *p, EOVmutexDerived *mutex
     @return     The required memory if available. NULL if the requedsted memory was zero but with a warning given
                 to the EOtheErrorManager. Issues a fatal error to the EOtheErrorManager if there was not memory anymore. 
     @warning    This function is thread-safe in static or mixed mode only if the EOtheMemoryPool has been protected 
-                by a proper mutex.
+                by a proper mutex. In eo_mempool_alloc_slab mode the free lists are protected by a spinlock where 
+                EO_ATOMIC_AVAILABLE is defined, otherwise by the mutex. In eo_mempool_alloc_dynamic mode it is thread-safe
+                if the heap functions are (as the default ones are) and the stats are changed with atomic operations 
+                where EO_ATOMIC_AVAILABLE is defined.
  **/ 
 extern void * eo_mempool_GetMemory(EOtheMemoryPool *p, eOmempool_alignment_t alignmode, uint16_t size, uint16_t number);
 
@@ -216,6 +293,9 @@ extern uint32_t eo_mempool_SizeOfAllocated(EOtheMemoryPool *p);
 
 extern eOmempool_alloc_mode_t eo_mempool_alloc_mode_Get(EOtheMemoryPool *p);
 
+// it tells if eo_mempool_Delete() gives back the memory, which happens in eo_mempool_alloc_dynamic and eo_mempool_alloc_slab modes.
+extern eObool_t eo_mempool_IsDeleteSupported(EOtheMemoryPool *p);
+
 
 /** @fn         extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size)
     @brief      Gives back memory using heap. If the singleton handler is NULL or if it was not initialised in dynamic mode,
@@ -226,6 +306,7 @@ extern eOmempool_alloc_mode_t eo_mempool_alloc_mode_Get(EOtheMemoryPool *p);
     @return     The required memory if available. NULL if the requested memory was zero but with a warning given
                 to the EOtheErrorManager. Issues a fatal error to the EOtheErrorManager if there was not memory anymore. 
     @warning    This can be used also if the singleton is in static/mixed mode. It uses heap, however.
+                In eo_mempool_alloc_slab mode it uses the free lists as eo_mempool_GetMemory().
  **/ 
 extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size);
 
@@ -241,6 +322,7 @@ extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size);
                 to the EOtheErrorManager. Issues a fatal error to the EOtheErrorManager if there was not memory anymore. 
     @warning    This can be used also if the singleton is in static/mixed mode. It uses heap, however. 
                 VERY IMPORTANT: it cannot be used with pointers coming from static allocation. The user MUST pay attention to use it properly.
+                In eo_mempool_alloc_slab mode it keeps the block if the new size fits in it.
  **/ 
 extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size);
  
@@ -253,11 +335,89 @@ extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size);
     @param      m               The pointer to the heap that we want to delete.    
     @warning    This can be used also if the singleton is in static/mixed mode. It deletes heap, however. 
                 VERY IMPORTANT: it cannot be used with pointers coming from static allocation. The user MUST pay attention 
-                to use it properly.
+                to use it properly. In eo_mempool_alloc_slab mode it puts the block back into its free list.
  **/  
 extern void eo_mempool_Delete(EOtheMemoryPool *p, void *m);
 
 
+/** @fn         extern eOresult_t eo_mempool_Arena_Init(EOtheMemoryPool *p, eOmempool_arena_t *arena, uint32_t capacity)
+    @brief      Gets from the pool a block of capacity bytes and assigns it to the arena.
+    @param      p               The handle to the mempool.
+    @param      arena           The arena. It is owned by the caller.
+    @param      capacity        The number of bytes of the block.
+    @return     eores_OK or eores_NOK_nullpointer.
+ **/
+extern eOresult_t eo_mempool_Arena_Init(EOtheMemoryPool *p, eOmempool_arena_t *arena, uint32_t capacity);
+
+
+/** @fn         extern eOmempool_arena_t * eo_mempool_Arena_Activate(EOtheMemoryPool *p, eOmempool_arena_t *arena)
+    @brief      Makes arena the active arena of the calling thread. While it is active, the memory is taken from its block and 
+                eo_mempool_Delete() does nothing for a pointer inside its block. It must be active also when the objects built 
+                inside it are deleted. Objects which use eo_mempool_Realloc() (e.g., EOvector of dynamic capacity) must not be 
+                built inside an arena.
+    @param      p               The handle to the mempool.
+    @param      arena           The arena or NULL to deactivate.
+    @return     The arena previously active, so that it can be restored.
+ **/
+extern eOmempool_arena_t * eo_mempool_Arena_Activate(EOtheMemoryPool *p, eOmempool_arena_t *arena);
+
+
+/** @fn         extern void eo_mempool_Arena_Release(EOtheMemoryPool *p, eOmempool_arena_t *arena)
+    @brief      Gives back the block of the arena in a single operation. It has effect only if eo_mempool_IsDeleteSupported().
+    @param      p               The handle to the mempool.
+    @param      arena           The arena.
+ **/
+extern void eo_mempool_Arena_Release(EOtheMemoryPool *p, eOmempool_arena_t *arena);
+
+
+/** @fn         extern eOresult_t eo_mempool_profile_Sites_Get(EOtheMemoryPool *p, const eOmempool_profile_site_t **sites, uint16_t *number)
+    @brief      Gives the table of the call sites. The entries with NULL file are empty.
+    @param      p               The handle to the mempool.
+    @param      sites           Receives the table.
+    @param      number          Receives the number of entries of the table.
+    @return     eores_OK, or eores_NOK_unsupported if EO_MEMPOOL_PROFILING is not defined.
+ **/
+extern eOresult_t eo_mempool_profile_Sites_Get(EOtheMemoryPool *p, const eOmempool_profile_site_t **sites, uint16_t *number);
+
+
+/** @fn         extern eOresult_t eo_mempool_profile_Marks_Get(EOtheMemoryPool *p, eOmempool_profile_mark_t *marks, uint16_t capacity, uint16_t *number)
+    @brief      Copies the last high water marks, from the oldest to the newest.
+    @param      p               The handle to the mempool.
+    @param      marks           Receives up to capacity marks.
+    @param      capacity        The capacity of marks.
+    @param      number          Receives the number of copied marks.
+    @return     eores_OK, or eores_NOK_unsupported if EO_MEMPOOL_PROFILING is not defined.
+ **/
+extern eOresult_t eo_mempool_profile_Marks_Get(EOtheMemoryPool *p, eOmempool_profile_mark_t *marks, uint16_t capacity, uint16_t *number);
+
+
+/** @fn         extern uint32_t eo_mempool_profile_Dump(EOtheMemoryPool *p, char *buffer, uint32_t size)
+    @brief      Writes in buffer a text with the totals, the accounting of every object type and of every call site, and 
+                the high water marks. The text is truncated to size-1 chars.
+    @param      p               The handle to the mempool.
+    @param      buffer          The buffer.
+    @param      size            The size of the buffer.
+    @return     The number of written chars, 0 if EO_MEMPOOL_PROFILING is not defined.
+ **/
+extern uint32_t eo_mempool_profile_Dump(EOtheMemoryPool *p, char *buffer, uint32_t size);
+
+
+#if defined(EO_MEMPOOL_PROFILING)
+// the versions which keep the accounting. use the normal names, which are redirected to them
+extern void * eo_mempool_profile_GetMemory(EOtheMemoryPool *p, eOmempool_alignment_t alignmode, uint16_t size, uint16_t number, const char *file, uint32_t line);
+extern void * eo_mempool_profile_New(EOtheMemoryPool *p, uint32_t size, const char *file, uint32_t line);
+extern void * eo_mempool_profile_Realloc(EOtheMemoryPool *p, void *m, uint32_t size, const char *file, uint32_t line);
+extern void eo_mempool_profile_Delete(EOtheMemoryPool *p, void *m);
+
+#if !defined(EO_MEMPOOL_PROFILING_IMPLEMENTATION)
+#define eo_mempool_GetMemory(p, alignmode, size, number)    eo_mempool_profile_GetMemory((p), (alignmode), (size), (number), __FILE__, __LINE__)
+#define eo_mempool_New(p, size)                             eo_mempool_profile_New((p), (size), __FILE__, __LINE__)
+#define eo_mempool_Realloc(p, m, size)                      eo_mempool_profile_Realloc((p), (m), (size), __FILE__, __LINE__)
+#define eo_mempool_Delete(p, m)                             eo_mempool_profile_Delete((p), (m))
+#endif
+#endif
+
+
 
 /** @}            
     end of group eo_thememorypool  
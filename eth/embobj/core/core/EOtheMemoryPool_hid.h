@@ -56,6 +56,13 @@ typedef struct
     uint32_t    usedbytespool;
 } eOmempool_stats_t;
 
+typedef struct
+{
+    void*                       freelist[eo_mempool_slab_classes];
+    uint16_t                    threadcachecapacity;
+    volatile uint32_t           lock;
+} eOmempool_slab_t;
+
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
 struct EOtheMemoryPool_hid 
@@ -67,6 +74,7 @@ struct EOtheMemoryPool_hid
     EOVmutex                        *mutex;
     eOreltime_t                     tout;
     eOmempool_stats_t               stats;
+    eOmempool_slab_t                theslab;
 }; 
 
 
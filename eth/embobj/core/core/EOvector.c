@@ -69,6 +69,10 @@
 
 static eOresult_t s_eo_vector_default_matching_rule(EOvector * vector, void *item, void *param);
 
+static void s_eo_vector_copyin(EOvector *vector, eOsizecntnr_t pos, const uint8_t *items, eOsizecntnr_t nitems);
+static void s_eo_vector_copyout(EOvector *vector, uint8_t *items, eOsizecntnr_t nitems);
+static void s_eo_vector_reverse(uint8_t *first, uint8_t *last);
+
 
 
 EO_static_inline void s_eo_vector_default_clear(void *item, EOvector* vector)
@@ -89,6 +93,18 @@ EO_static_inline void s_eo_vector_default_init(void* item,  EOvector* vector)
     memset(item, 0, vector->item_size);
 }
 
+EO_static_inline uint8_t* s_eo_vector_item(EOvector *vector, eOsizecntnr_t pos)
+{
+    // vector->first is always 0 unless in ring mode, thus for a normal vector this is just the pos-th item.
+    // we use uint32_t so that first+pos cannot overflow and the index of the array can be bigger than max eOsizecntnr_t
+    uint32_t i = (uint32_t)vector->first + pos;
+    if(i >= vector->capacity)
+    {
+        i -= vector->capacity;
+    }
+    return(&((uint8_t*)vector->stored_items)[i * vector->item_size]);
+}
+
 //EO_static_inline void s_eo_vector_default_initall(EOvector* vector)
 //{
 //    memset(vector->stored_items, 0, vector->capacity*vector->item_size);
@@ -131,6 +147,9 @@ extern EOvector* eo_vector_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
     retptr->dummy               = 0;
     retptr->capacity            = capacity;
     retptr->functions           = NULL;
+    retptr->first               = 0;
+    retptr->ring                = eobool_false;
+    retptr->filler              = 0;
     if((NULL != item_init) || (NULL != item_copy) || (NULL != item_clear))
     {
         retptr->functions = (EOcontainer_functions_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOcontainer_functions_t), 1);
@@ -144,7 +163,7 @@ extern EOvector* eo_vector_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
     
     if(eo_vectorcapacity_dynamic == retptr->capacity)
     {      
-        eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_vector_New(): cannot use eo_vectorcapacity_dynamic", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+        eo_errman_Assert(eo_errman_GetHandle(), (eobool_true == eo_mempool_IsDeleteSupported(eo_mempool_GetHandle())), "eo_vector_New(): cannot use eo_vectorcapacity_dynamic", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
         retptr->stored_items = NULL;
     }
     else
@@ -196,6 +215,22 @@ extern EOvector* eo_vector_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
 }
 
 
+extern EOvector* eo_vector_NewRing(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                   eOres_fp_voidp_uint32_t item_init, uint32_t init_par,  
+                                   eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear)
+{
+    EOvector *retptr = NULL;
+    
+    // the ring needs all its memory at creation
+    eo_errman_Assert(eo_errman_GetHandle(), (eo_vectorcapacity_dynamic != capacity), "eo_vector_NewRing(): cannot use eo_vectorcapacity_dynamic", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    
+    retptr = eo_vector_New(item_size, capacity, item_init, init_par, item_copy, item_clear);
+    retptr->ring = eobool_true;
+    
+    return(retptr);
+}
+
+
 extern eOsizecntnr_t eo_vector_Capacity(EOvector * vector) 
 {
     if(NULL == vector) 
@@ -220,7 +255,6 @@ extern eOsizecntnr_t eo_vector_ItemSize(EOvector * vector)
 extern void eo_vector_PushBack(EOvector * vector, void *p) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
         
     if((NULL == vector) || (NULL == p)) 
@@ -238,9 +272,7 @@ extern void eo_vector_PushBack(EOvector * vector, void *p)
         vector->stored_items = eo_mempool_Realloc(eo_mempool_GetHandle(), vector->stored_items, (uint32_t)(vector->size+1) * vector->item_size);
     }
             
-    start = (uint8_t*) (vector->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)vector->size * vector->item_size]; 
+    item = s_eo_vector_item(vector, vector->size); 
     
     if((NULL != vector->functions) && (NULL != vector->functions->item_copy_fn)) 
     {
@@ -273,8 +305,7 @@ extern void * eo_vector_Back(EOvector * vector)
         return(start);     
     }
      
-    start = (uint8_t*) (vector->stored_items);
-    item = &start[(uint32_t)(vector->size-1) * vector->item_size];
+    item = s_eo_vector_item(vector, vector->size-1);
     
     return((void*) item);         
 }
@@ -283,7 +314,6 @@ extern void * eo_vector_Back(EOvector * vector)
 extern void eo_vector_PopBack(EOvector * vector) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     
     if(NULL == vector) 
@@ -296,8 +326,7 @@ extern void eo_vector_PopBack(EOvector * vector)
         return;     
     }
 
-    start = (uint8_t*) (vector->stored_items);
-    item = &start[(uint32_t)(vector->size - 1) * vector->item_size];            
+    item = s_eo_vector_item(vector, vector->size - 1);            
     
     if((NULL != vector->functions) && (NULL != vector->functions->item_clear_fn))
     {
@@ -336,20 +365,27 @@ extern void eo_vector_PushFront(EOvector * vector, void *p)
         return;
     }
        
-       
-    // if dynamic, then we need to have one more item.
-    if(eo_vectorcapacity_dynamic == vector->capacity)
-    {   // in here i dont make any control because in _New() we have already verified that mempool is dynamic 
-        vector->stored_items = eo_mempool_Realloc(eo_mempool_GetHandle(), vector->stored_items, (uint32_t)(vector->size+1) * vector->item_size);
+    if(eobool_true == vector->ring)
+    {   // the front just moves one position back inside the ring
+        vector->first = (0 == vector->first) ? (vector->capacity - 1) : (vector->first - 1);
+        item = s_eo_vector_item(vector, 0);
     }
+    else
+    {
+        // if dynamic, then we need to have one more item.
+        if(eo_vectorcapacity_dynamic == vector->capacity)
+        {   // in here i dont make any control because in _New() we have already verified that mempool is dynamic 
+            vector->stored_items = eo_mempool_Realloc(eo_mempool_GetHandle(), vector->stored_items, (uint32_t)(vector->size+1) * vector->item_size);
+        }
     
-    start = (uint8_t*) (vector->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[0]; 
-    second = &start[(uint32_t)1 * vector->item_size];     
+        start = (uint8_t*) (vector->stored_items);
+        // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
+        item = &start[0]; 
+        second = &start[(uint32_t)1 * vector->item_size];     
     
-    // now i must memmove from front into second   
-    memmove(second, vector->stored_items, vector->size * vector->item_size); 
+        // now i must memmove from front into second   
+        memmove(second, vector->stored_items, vector->size * vector->item_size); 
+    }
     
     // now we have the first position available and we can copy p into it.
     
@@ -384,8 +420,7 @@ extern void * eo_vector_Front(EOvector * vector)
         return(start);     
     }
      
-    start = (uint8_t*) (vector->stored_items);
-    item = &start[0];
+    item = s_eo_vector_item(vector, 0);
     
     return((void*) item);         
 }
@@ -408,7 +443,7 @@ extern void eo_vector_PopFront(EOvector * vector)
     }
 
     start = (uint8_t*) (vector->stored_items);
-    item = &start[0]; 
+    item = s_eo_vector_item(vector, 0); 
     second = &start[(uint32_t)(1) * vector->item_size];    
     
     if((NULL != vector->functions) && (NULL != vector->functions->item_clear_fn))
@@ -423,6 +458,12 @@ extern void eo_vector_PopFront(EOvector * vector)
     
     vector->size --;
     
+    if(eobool_true == vector->ring)
+    {   // the front just moves one position ahead inside the ring: no need to move memory
+        vector->first = (0 == vector->size) ? (0) : ((vector->first + 1) % vector->capacity);
+        return;
+    }
+    
     
     // now we must move memory starting from second to start for an amount of (vector->size * vector->item_size)
     // if size is zero, the function memmove() does not copy anything 
@@ -440,6 +481,95 @@ extern void eo_vector_PopFront(EOvector * vector)
 }
 
 
+extern eOsizecntnr_t eo_vector_PushBackMany(EOvector * vector, const void *items, eOsizecntnr_t nitems) 
+{
+    eOsizecntnr_t n = 0;
+        
+    if((NULL == vector) || (NULL == items)) 
+    {   // invalid data
+        return(0);    
+    }
+    
+    n = vector->capacity - vector->size;
+    if(nitems < n)
+    {
+        n = nitems;
+    }
+    
+    if(0 == n) 
+    {   // vector is full or nothing to copy
+        return(0);
+    }
+    
+    if(eo_vectorcapacity_dynamic == vector->capacity)
+    {   // in here i dont make any control because in _New() we have already verified that mempool is dynamic 
+        vector->stored_items = eo_mempool_Realloc(eo_mempool_GetHandle(), vector->stored_items, (uint32_t)(vector->size+n) * vector->item_size);
+    }
+    
+    s_eo_vector_copyin(vector, vector->size, (const uint8_t*)items, n);    
+    vector->size += n;
+    
+    return(n); 
+}
+
+
+extern eOsizecntnr_t eo_vector_PopFrontMany(EOvector * vector, void *items, eOsizecntnr_t nitems) 
+{
+    uint8_t *item = NULL;   
+    eOsizecntnr_t n = 0;
+    eOsizecntnr_t i = 0;
+    
+    if(NULL == vector) 
+    {   // invalid vector
+        return(0);    
+    }
+    
+    n = (nitems < vector->size) ? (nitems) : (vector->size);
+    
+    if(0 == n) 
+    {   // vector is empty or nothing to remove
+        return(0);     
+    }
+    
+    if(NULL != items)
+    {
+        s_eo_vector_copyout(vector, (uint8_t*)items, n);
+    }
+    
+    for(i=0; i<n; i++)
+    {
+        item = s_eo_vector_item(vector, i);
+        if((NULL != vector->functions) && (NULL != vector->functions->item_clear_fn))
+        {
+            vector->functions->item_clear_fn(item);
+        } 
+        else 
+        { 
+            s_eo_vector_default_clear(item, vector);
+        }
+    }
+    
+    vector->size -= n;
+    
+    if(eobool_true == vector->ring)
+    {   // the front just moves n positions ahead inside the ring
+        vector->first = (0 == vector->size) ? (0) : ((uint32_t)(vector->first + n) % vector->capacity);
+        return(n);
+    }
+    
+    // a single memmove() for all the removed items
+    memmove(vector->stored_items, (uint8_t*)vector->stored_items + (uint32_t)n * vector->item_size, (uint32_t)vector->size * vector->item_size); 
+    
+    // if size is zero, eo_mempool_Realloc() calls eo_mempool_Free() and returns NULL. that is correct.
+    if(eo_vectorcapacity_dynamic == vector->capacity)
+    {   // in here i dont make any control because in _New() we have already verified that mempool is dynamic 
+        vector->stored_items = eo_mempool_Realloc(eo_mempool_GetHandle(), vector->stored_items, (uint32_t)(vector->size) * vector->item_size);
+    }
+    
+    return(n);
+}
+
+
 extern eOsizecntnr_t eo_vector_Size(EOvector * vector) 
 {
     if(NULL == vector) 
@@ -454,7 +584,6 @@ extern eOsizecntnr_t eo_vector_Size(EOvector * vector)
 extern void eo_vector_Clear(EOvector * vector) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     eOsizecntnr_t i = 0;        
     
@@ -470,11 +599,9 @@ extern void eo_vector_Clear(EOvector * vector)
     }
     
 
-    start = (uint8_t*) (vector->stored_items);
     for(i=0; i<vector->size; i++) 
-    {   // i use i as index because the items in a vector are always stored from pos 0 to size-1
-        // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-        item = &start[(uint32_t)i * vector->item_size];
+    {   // i use i as index because the items in a vector are always stored from pos 0 to size-1 (after first if in ring mode)
+        item = s_eo_vector_item(vector, i);
         if((NULL != vector->functions) && (NULL != vector->functions->item_clear_fn))
         {
             vector->functions->item_clear_fn(item);
@@ -487,6 +614,7 @@ extern void eo_vector_Clear(EOvector * vector)
         
     
     vector->size = 0;
+    vector->first = 0;
     
     //its ok to use realloc when size is zero because eo_mempool_Realloc() calls eo_mempool_Free() and returns NULL.
     if(eo_vectorcapacity_dynamic == vector->capacity)
@@ -499,7 +627,6 @@ extern void eo_vector_Clear(EOvector * vector)
 extern void * eo_vector_At(EOvector * vector, eOsizecntnr_t pos) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     
     if(NULL == vector) 
@@ -513,21 +640,13 @@ extern void * eo_vector_At(EOvector * vector, eOsizecntnr_t pos)
     }
     
    
-    start = (uint8_t*) (vector->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)pos * vector->item_size];
+    item = s_eo_vector_item(vector, pos);
     
     return((void*) item);         
 }
 
 extern void eo_vector_Assign(EOvector * vector, eOsizecntnr_t pos, void *items, eOsizecntnr_t nitems)
 {
-    // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
-    uint8_t *p = NULL;          // external item
-    uint8_t *item = NULL;       // internal item
-    uint16_t i;
-        
     if((NULL == vector) || (NULL == items) || (0 == nitems)) 
     {   // invalid data
         return;    
@@ -545,27 +664,7 @@ extern void eo_vector_Assign(EOvector * vector, eOsizecntnr_t pos, void *items,
     }
     
     // now fill from pos-th position until (pos+nitems-1)-th position w/ objects pointed by items
-    
-    
-    start = (uint8_t*) (vector->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)pos * vector->item_size]; 
-    p = (uint8_t*) items;    // first ext item of items[]
-    
-    for(i=0; i<nitems; i++)
-    {
-        if((NULL != vector->functions) && (NULL != vector->functions->item_copy_fn))
-        {
-            vector->functions->item_copy_fn(item, p);
-        }
-        else
-        {
-            s_eo_vector_default_copy(item, p, vector);
-        } 
-        
-        item += vector->item_size;
-        p += vector->item_size;
-    }
+    s_eo_vector_copyin(vector, pos, (const uint8_t*)items, nitems);
     
     return;     
 }
@@ -577,6 +676,14 @@ extern void* eo_vector_storage_Get(EOvector * vector)
         return (NULL);    
     }    
     
+    if((eobool_true == vector->ring) && (0 != vector->first))
+    {   // the caller expects the items from position 0: rotate the ring so that the front is at the start of storage
+        s_eo_vector_reverse((uint8_t*)vector->stored_items, s_eo_vector_item(vector, 0));
+        s_eo_vector_reverse(s_eo_vector_item(vector, 0), (uint8_t*)vector->stored_items + (uint32_t)vector->capacity * vector->item_size);
+        s_eo_vector_reverse((uint8_t*)vector->stored_items, (uint8_t*)vector->stored_items + (uint32_t)vector->capacity * vector->item_size);
+        vector->first = 0;
+    }
+    
     return(vector->stored_items);   
 }
 
@@ -584,7 +691,6 @@ extern void* eo_vector_storage_Get(EOvector * vector)
 extern void eo_vector_AssignOne(EOvector * vector, eOsizecntnr_t pos, void *p) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
         
     if((NULL == vector) || (NULL == p)) 
@@ -606,9 +712,7 @@ extern void eo_vector_AssignOne(EOvector * vector, eOsizecntnr_t pos, void *p)
     // now fill the pos-th position w/ object p
     
     
-    start = (uint8_t*) (vector->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)pos * vector->item_size]; 
+    item = s_eo_vector_item(vector, pos); 
     
     if((NULL != vector->functions) && (NULL != vector->functions->item_copy_fn))
     {
@@ -626,7 +730,6 @@ extern void eo_vector_AssignOne(EOvector * vector, eOsizecntnr_t pos, void *p)
 extern void eo_vector_Resize(EOvector * vector, eOsizecntnr_t size) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     eOsizecntnr_t first;
     eOsizecntnr_t last;
@@ -683,11 +786,9 @@ extern void eo_vector_Resize(EOvector * vector, eOsizecntnr_t size)
         }
         
         // ok, now i init the new memory as if it was just created. we do it for the new items.
-        start = (uint8_t*) (vector->stored_items);
         for(i=first; i<last; i++) 
         {
-            // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-            item = &start[(uint32_t)i * vector->item_size];
+            item = s_eo_vector_item(vector, i);
             if((NULL != vector->functions) && (NULL != vector->functions->item_init_fn))
             {
                 vector->functions->item_init_fn(item, vector->functions->item_init_par);
@@ -702,11 +803,9 @@ extern void eo_vector_Resize(EOvector * vector, eOsizecntnr_t size)
     else
     {   // must destroy the items
     
-        start = (uint8_t*) (vector->stored_items);
         for(i=first; i<last; i++) 
         {
-            // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-            item = &start[(uint32_t)i * vector->item_size];
+            item = s_eo_vector_item(vector, i);
             if((NULL != vector->functions) && (NULL != vector->functions->item_clear_fn))
             {
                 vector->functions->item_clear_fn(item);
@@ -755,6 +854,7 @@ extern eObool_t eo_vector_Find(EOvector * vector, eOresult_t (matching_rule)(voi
 {
     eOsizecntnr_t i = 0;
     uint8_t *item;    
+    uint8_t *end = NULL;
     eOresult_t res = eores_NOK_generic;
 
 
@@ -764,9 +864,19 @@ extern eObool_t eo_vector_Find(EOvector * vector, eOresult_t (matching_rule)(voi
     }
     
 
+    if(eobool_true == vector->ring)
+    {   // in ring mode the walk wraps at the end of storage
+        end = (uint8_t*) (vector->stored_items) + (uint32_t)vector->capacity * vector->item_size;
+    }
+    
     // loop over all items to see is any matches with external data
-    for(i=0, item = (uint8_t*) (vector->stored_items); i<vector->size; i++, item += vector->item_size)
+    for(i=0, item = s_eo_vector_item(vector, 0); i<vector->size; i++, item += vector->item_size)
     {
+        if(item == end)
+        {
+            item = (uint8_t*) (vector->stored_items);
+        }
+        
         //if(0 == memcmp(param, item, vector->item_size))
         
         if(NULL != matching_rule)
@@ -796,15 +906,25 @@ extern void eo_vector_Execute(EOvector *vector, void (execute)(void *item, void
 {
     eOsizecntnr_t i = 0;
     uint8_t *item;    
+    uint8_t *end = NULL;
 
     if((NULL == vector) || (NULL == execute)) 
     {
          return;
     }
     
+    if(eobool_true == vector->ring)
+    {   // in ring mode the walk wraps at the end of storage
+        end = (uint8_t*) (vector->stored_items) + (uint32_t)vector->capacity * vector->item_size;
+    }
+    
     // loop over all items to call the execute()
-    for(i=0, item = (uint8_t*) (vector->stored_items); i<vector->size; i++, item += vector->item_size)
+    for(i=0, item = s_eo_vector_item(vector, 0); i<vector->size; i++, item += vector->item_size)
     {
+        if(item == end)
+        {
+            item = (uint8_t*) (vector->stored_items);
+        }
         execute(item, param);
     }
     
@@ -861,6 +981,75 @@ static eOresult_t s_eo_vector_default_matching_rule(EOvector * vector, void *ite
 }
 
 
+static void s_eo_vector_copyin(EOvector *vector, eOsizecntnr_t pos, const uint8_t *items, eOsizecntnr_t nitems)
+{
+    uint8_t *start = (uint8_t*) (vector->stored_items);
+    uint8_t *item = NULL;
+    uint32_t chunk = 0;
+    eOsizecntnr_t i = 0;
+    
+    if((NULL != vector->functions) && (NULL != vector->functions->item_copy_fn))
+    {   // specialised copy: one item at a time
+        for(i=0; i<nitems; i++)
+        {
+            vector->functions->item_copy_fn(s_eo_vector_item(vector, pos+i), (void*)&items[(uint32_t)i * vector->item_size]);
+        }
+        return;
+    }
+    
+    // plain bytes: one memcpy() up to the end of storage and, only in ring mode, another one from its start
+    item = s_eo_vector_item(vector, pos);
+    chunk = (uint32_t)vector->capacity - (uint32_t)(item - start) / vector->item_size;
+    if(chunk > nitems)
+    {
+        chunk = nitems;
+    }
+    memcpy(item, items, chunk * vector->item_size);
+    memcpy(start, &items[chunk * vector->item_size], (uint32_t)(nitems - chunk) * vector->item_size);
+}
+
+
+static void s_eo_vector_copyout(EOvector *vector, uint8_t *items, eOsizecntnr_t nitems)
+{
+    uint8_t *start = (uint8_t*) (vector->stored_items);
+    uint8_t *item = NULL;
+    uint32_t chunk = 0;
+    eOsizecntnr_t i = 0;
+    
+    if((NULL != vector->functions) && (NULL != vector->functions->item_copy_fn))
+    {   // specialised copy: one item at a time
+        for(i=0; i<nitems; i++)
+        {
+            vector->functions->item_copy_fn(&items[(uint32_t)i * vector->item_size], s_eo_vector_item(vector, i));
+        }
+        return;
+    }
+    
+    // plain bytes: one memcpy() up to the end of storage and, only in ring mode, another one from its start
+    item = s_eo_vector_item(vector, 0);
+    chunk = (uint32_t)vector->capacity - (uint32_t)(item - start) / vector->item_size;
+    if(chunk > nitems)
+    {
+        chunk = nitems;
+    }
+    memcpy(items, item, chunk * vector->item_size);
+    memcpy(&items[chunk * vector->item_size], start, (uint32_t)(nitems - chunk) * vector->item_size);
+}
+
+
+static void s_eo_vector_reverse(uint8_t *first, uint8_t *last)
+{   // reverses the bytes in [first, last)
+    uint8_t tmp = 0;
+    
+    while((first != last) && (first != --last))
+    {
+        tmp = *first;
+        *first++ = *last;
+        *last = tmp;
+    }
+}
+
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -103,6 +103,22 @@ extern EOvector * eo_vector_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
                                 eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear);
 
 
+/** @fn         extern EOvector * eo_vector_NewRing(eOsizeitem_t item_size, eOsizecntnr_t capacity, 
+                                                 eOres_fp_voidp_uint32_t item_init, uint32_t init_par, 
+                                                 eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear);
+    @brief      Creates a new EOvector object as eo_vector_New() does, but which keeps its items in a ring, so that
+                eo_vector_PushFront(), eo_vector_PopFront() and eo_vector_PopFrontMany() do not move memory and 
+                are O(1). Every other function behaves as for a normal EOvector.
+    @param      capacity        The max number of item objects. It cannot be eo_vectorcapacity_dynamic.
+    @return     Pointer to the required EOvector object.
+    @warning    eo_vector_storage_Get() on a ring vector rotates its storage in O(capacity) so that the front is 
+                at its start. 
+ **/
+extern EOvector * eo_vector_NewRing(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                    eOres_fp_voidp_uint32_t item_init, uint32_t init_par, 
+                                    eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear);
+
+
 /** @fn         extern eOsizecntnr_t eo_vector_Capacity(EOvector * vector)
     @brief      Returns the maximum number of item objects that the EOvector is able to contain.
     @param      vector           Pointer to the EOvector object.
@@ -136,6 +152,18 @@ extern eOsizecntnr_t eo_vector_Size(EOvector * vector);
 extern void eo_vector_PushBack(EOvector * vector, void *p);
 
 
+/** @fn         extern eOsizecntnr_t eo_vector_PushBackMany(EOvector * vector, const void *items, eOsizecntnr_t nitems)
+    @brief      Copies up to @e nitems contiguous item objects at the back of the EOvector, stopping when it is full.
+                If no @e item_copy was passed in eo_vector_New() the copy is done with a single memcpy(), or
+                two if a ring vector wraps.
+    @param      vector          Pointer to the EOvector object.
+    @param      items           Pointer to an array of item objects.
+    @param      nitems          Number of item objects in @e items.
+    @return     The number of item objects which have been copied.
+ **/
+extern eOsizecntnr_t eo_vector_PushBackMany(EOvector * vector, const void *items, eOsizecntnr_t nitems);
+
+
 /** @fn         extern void* eo_vector_Back(EOvector *vector)
     @brief      Retrieves a reference to the item object in the back of the EOvector without removing it. 
     @param      vector           Pointer to the EOvector object.
@@ -183,6 +211,19 @@ extern void* eo_vector_Front(EOvector * vector);
 extern void eo_vector_PopFront(EOvector * vector); 
 
 
+/** @fn         extern eOsizecntnr_t eo_vector_PopFrontMany(EOvector * vector, void *items, eOsizecntnr_t nitems)
+    @brief      Removes up to @e nitems item objects from the front of the EOvector. If @e items is not NULL 
+                the removed item objects are first copied into it. Each removed item object is then destroyed as
+                in eo_vector_PopFront(). The remaining items are moved down with a single memmove(), or not moved
+                at all in a ring vector.
+    @param      vector          Pointer to the EOvector object.
+    @param      items           Pointer to an array which receives the item objects, or NULL.
+    @param      nitems          Max number of item objects to remove.
+    @return     The number of item objects which have been removed.
+ **/
+extern eOsizecntnr_t eo_vector_PopFrontMany(EOvector * vector, void *items, eOsizecntnr_t nitems);
+
+
 /** @fn         extern void eo_vector_clear(EOvector * vector)
     @brief      Removes all item objects from the EOvector and for each one calls its destructor 
                 @e item_dtor() if passed not NULL in eo_vector_new(). Finally sets memory to zero.
@@ -218,6 +259,16 @@ extern void * eo_vector_At(EOvector * vector, eOsizecntnr_t pos);
 extern void eo_vector_AssignOne(EOvector * vector, eOsizecntnr_t pos, void *p);
 
 
+/** @fn         extern void eo_vector_Assign(EOvector * vector, eOsizecntnr_t pos, void *items, eOsizecntnr_t nitems)
+    @brief      Assigns the @e nitems contiguous item objects in @e items to the positions from @e pos onwards,
+                resizing the EOvector if needed. If no @e item_copy was passed in eo_vector_New() the copy is
+                done with a single memcpy(), or two if a ring vector wraps.
+    @param      vector          Pointer to the EOvector object.
+    @param      pos             First position where to assign.
+    @param      items           Pointer to an array of item objects.
+    @param      nitems          Number of item objects in @e items.
+    @warning    If the last position is beyond the capacity of the EOvector, the function shall do nothing
+ **/
 extern void eo_vector_Assign(EOvector * vector, eOsizecntnr_t pos, void *items, eOsizecntnr_t nitems);
 
 
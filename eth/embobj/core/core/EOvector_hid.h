@@ -68,6 +68,9 @@ struct EOvector_hid
     uint16_t                    dummy;              
     void                        *stored_items;      /**< array of item object. */   
     EOcontainer_functions_t     *functions;
+    eOsizecntnr_t               first;              /**< position inside stored_items of the item at index 0. it is always 0 unless in ring mode. */
+    eObool_t                    ring;               /**< if eobool_true the items are kept in a ring and PushFront / PopFront are O(1). */
+    uint8_t                     filler;
 };
 
 
@@ -200,6 +200,43 @@ extern "C" {
 #define __emBODYportingVERIFYsizeof(sname, ssize)    typedef uint8_t GUARD##sname[ ( ssize == sizeof(sname) ) ? (1) : (-1)];
 
 
+// atomic operations used by the lock-free parts of embOBJ. they are available only if EO_ATOMIC_AVAILABLE is defined.
+// EO_atomic_cas32(ptr, expected, desired) writes desired in *ptr only if *ptr is equal to expected and returns non-zero in such a case.
+// EO_atomic_barrier() is a full memory barrier. the old armcc has only the barrier, thus with it EO_atomic_barrier() is
+// defined but EO_ATOMIC_AVAILABLE is not.
+#if defined(_MSC_VER)
+    #include <intrin.h>
+    #define EO_ATOMIC_AVAILABLE
+    #define EO_atomic_cas32(ptr, expected, desired)     ((long)(expected) == _InterlockedCompareExchange((volatile long*)(ptr), (long)(desired), (long)(expected)))
+    // _ReadWriteBarrier() stops only the reordering of the compiler, thus we also need the fence of the cpu. it is what 
+    // MemoryBarrier() of <windows.h> does, which we dont want to include in here.
+    #if defined(_M_ARM) || defined(_M_ARM64)
+    #define EO_atomic_barrier()                         do { _ReadWriteBarrier(); __dmb(0xF); } while(0)
+    #else
+    #define EO_atomic_barrier()                         do { _ReadWriteBarrier(); _mm_mfence(); } while(0)
+    #endif
+#elif defined(__GNUC__) && !defined(_DSPIC_) && !(defined(__ARMCC_VERSION) && (__ARMCC_VERSION < 6000000))
+    // gcc, clang and armclang. the old armcc does not have the __sync builtins
+    #define EO_ATOMIC_AVAILABLE
+    #define EO_atomic_cas32(ptr, expected, desired)     __sync_bool_compare_and_swap((ptr), (expected), (desired))
+    #define EO_atomic_barrier()                         __sync_synchronize()
+#elif defined(__ARMCC_VERSION) && (__ARMCC_VERSION < 6000000)
+    #define EO_atomic_barrier()                         __dmb(0xF)
+#endif
+
+// EO_thread_local gives a static variable one instance per thread on the multi-threaded hosts, where EO_THREAD_LOCAL_AVAILABLE
+// is defined. on the other platforms it is empty.
+#if defined(_MSC_VER)
+    #define EO_THREAD_LOCAL_AVAILABLE
+    #define EO_thread_local     __declspec(thread)
+#elif defined(EO_TAILOR_CODE_FOR_LINUX) || defined(__APPLE__)
+    #define EO_THREAD_LOCAL_AVAILABLE
+    #define EO_thread_local     __thread
+#else
+    #define EO_thread_local
+#endif
+
+
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
 
 typedef int8_t emBODYporting_enum08_t;
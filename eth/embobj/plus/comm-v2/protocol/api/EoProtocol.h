@@ -281,6 +281,38 @@ typedef struct
     uint8_t             numberofentities[eoprot_entities_maxnumberofsupported];     /*< the multiplicity of each entity in position of the entity */
 } eOprot_EPcfg_t;
 
+
+/** @typedef    typedef struct eOprot_IDsclassification_t
+    @brief      it contains the outputs of eoprot_IDs_classify() as a structure of arrays, each one with one item per ID. 
+                any pointer can be NULL if that information is not required.
+ **/
+typedef struct
+{
+    eOprotEndpoint_t*   endpoint;       /*< as eoprot_ID2endpoint() */
+    eOprotEntity_t*     entity;         /*< as eoprot_ID2entity() */
+    eOprotIndex_t*      index;          /*< as eoprot_ID2index() */
+    eOprotTag_t*        tag;            /*< as eoprot_ID2tag() */
+    uint16_t*           prognum;        /*< as eoprot_endpoint_id2prognum() or EOK_uint16dummy if the ID is not valid */
+    eObool_t*           valid;          /*< as eoprot_id_isvalid() */
+} eOprot_IDsclassification_t;
+
+
+/** @typedef    typedef struct eOprot_EPhistogram_t
+    @brief      the number of valid IDs for each endpoint and the number of the not valid ones
+ **/
+typedef struct
+{
+    uint16_t            endpoint[eoprot_endpoints_numberof];
+    uint16_t            invalid;
+} eOprot_EPhistogram_t;
+
+
+/** @typedef    typedef void (*eOprot_fp_onentityaccess_t)(void* arg, eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotIndex_t index)
+    @brief      the function called by eoprot_entity_ramof_get() and eoprot_variable_ramof_get() before they give the ram of an entity.
+                it is used by who prepares the ram of the entities only when it is needed.
+ **/
+typedef void (*eOprot_fp_onentityaccess_t)(void* arg, eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotIndex_t index);
+
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
 extern const eOprot_EPcfg_t eoprot_arrayof_stdEPcfg[eoprot_endpoints_numberof];
@@ -432,11 +464,13 @@ extern const eoprot_version_t * eoprot_version_of_endpoint_get(eOprotEndpoint_t
 /** @fn         extern eOresult_t eoprot_config_board_reserve(eOprotBRD_t brd)
     @brief      it configures the library so that this particular board can be managed.
                 if the board is eoprot_board_localboard then the space is already allocated.
-                if instead is a given number then if we use dynamic mode then the memory is allocated / reallocated
-                to host an array index of value equal to brd. thus if we reserve for brd = 2, then 4, then 0, then 1
-                the memory is allocated to host 3 boards, then 4, then nothing is done because 0 and 1 are already supported.
+                if instead is a given number then if we use dynamic mode then the memory is allocated for every board
+                up to brd which does not have it yet. thus if we reserve for brd = 2, then 4, then 0, then 1
+                the memory is allocated for boards 0, 1, 2, then for 3 and 4, then nothing is done because 0 and 1 are already supported.
                 in case of static allocation we never allocate.
                 in both cases we retrun error if brd >= eoprot_boards_maxnumberof
+                the function can be called by concurrent threads, also while other threads use the boards already reserved,
+                because the data of a board never moves. 
     @param      brd                 the number of board 
     @return     eores_OK or eores_NOK_generic upon failure.
  **/
@@ -482,6 +516,15 @@ extern eOresult_t eoprot_config_endpoint_entities(eOprotBRD_t brd, eOprotEndpoin
 extern eOresult_t eoprot_config_proxied_variables(eOprotBRD_t brd, eOprotEndpoint_t ep, eObool_fp_uint32_t isvarproxied_fn);
 
 
+/** @fn         extern uint32_t eoprot_config_proxied_variables_changes_get(eOprotBRD_t brd)
+    @brief      it tells how many times eoprot_config_proxied_variables() has been called for the board, so that who keeps
+                a cache of eoprot_variable_is_proxied() can tell when it must be evaluated again.
+    @param      brd                 the number of board 
+    @return     the number of changes, 0 if the board does not exist.
+ **/
+extern uint32_t eoprot_config_proxied_variables_changes_get(eOprotBRD_t brd);
+
+
 /** @fn         extern eObool_t eoprot_endpoint_configured_is(eOprotBRD_t brd, eOprotEndpoint_t ep)
     @brief      it tells if a given board has a given endpoint configured.
     @param      brd                 the number of board 
@@ -641,6 +684,19 @@ extern uint16_t eoprot_endpoint_sizeof_get(eOprotBRD_t brd, eOprotEndpoint_t ep)
 extern eOresult_t eoprot_config_endpoint_ram(eOprotBRD_t brd, eOprotEndpoint_t ep, void* ram, uint16_t sizeofram);
 
 
+/** @fn         extern eOresult_t eoprot_config_endpoint_onentityaccess(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprot_fp_onentityaccess_t fn, void* arg)
+    @brief      it configures a function which is called every time the ram of an entity of the endpoint is asked by 
+                eoprot_entity_ramof_get() or eoprot_variable_ramof_get(). it is removed by eoprot_config_endpoint_ram() with NULL ram
+                or by calling this function with NULL fn.
+    @param      brd                 the number of board 
+    @param      ep                  the endpoint
+    @param      fn                  the function or NULL
+    @param      arg                 the first argument of fn
+    @return     eores_OK or eores_NOK_generic upon failure.
+ **/
+extern eOresult_t eoprot_config_endpoint_onentityaccess(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprot_fp_onentityaccess_t fn, void* arg);
+
+
 /** @fn         extern void* eoprot_variable_ramof_get(eOprotBRD_t brd, eOprotID32_t id)
     @brief      it gets the ram of the variable on a given (board, ID). The dependency from the board is necessary because
                 for the same endpoint the number of entities may be different.
@@ -769,6 +825,19 @@ extern eOprotID32_t eoprot_endpoint_prognum2id(eOprotBRD_t brd, eOprotEndpoint_t
 extern eOprotProgNumber_t eoprot_endpoint_id2prognum(eOprotBRD_t brd, eOprotID32_t id);
 
 
+/** @fn         extern eOresult_t eoprot_IDs_classify(eOprotBRD_t brd, const eOprotID32_t *ids, uint16_t numberofids, eOprot_IDsclassification_t *classification, eOprot_EPhistogram_t *histogram)
+    @brief      it decodes and validates an array of IDs on a given board in one call. the decoding is done in a separate loop 
+                of shifts and masks only, which the compiler can vectorise. 
+    @param      brd             the number of the board.
+    @param      ids             the IDs.
+    @param      numberofids     the number of IDs.
+    @param      classification  if not NULL, the arrays (of at least numberofids items) which are not NULL are filled.
+    @param      histogram       if not NULL, it is filled with the number of valid IDs for each endpoint.
+    @return     eores_NOK_nullpointer if ids is NULL, eores_NOK_generic if the board does not exist, else eores_OK.
+ **/
+extern eOresult_t eoprot_IDs_classify(eOprotBRD_t brd, const eOprotID32_t *ids, uint16_t numberofids, eOprot_IDsclassification_t *classification, eOprot_EPhistogram_t *histogram);
+
+
 extern void* eoprot_endpoint_ramof_get(eOprotBRD_t brd, eOprotEndpoint_t ep);
 
 
@@ -71,6 +71,13 @@ typedef struct
     const uint8_t*      numberofeachentity[eoprot_endpoints_numberof];   
     void*               ramofeachendpoint[eoprot_endpoints_numberof];   
     eObool_fp_uint32_t  isvarproxied_fn[eoprot_endpoints_numberof];        
+    uint32_t            isvarproxied_changes;
+    eOprot_fp_onentityaccess_t  onentityaccess_fn[eoprot_endpoints_numberof];
+    void*               onentityaccess_arg[eoprot_endpoints_numberof];
+    // prefix sums over the entities of each endpoint, computed by eoprot_config_endpoint_entities(). in position i there
+    // is the sum for all the entities before the i-th, thus in position eoprot_ep_entities_numberof[epi] there is the total.
+    uint16_t            ramoffsetofentity[eoprot_endpoints_numberof][eoprot_entities_maxnumberofsupported+1];
+    uint16_t            prognumofentity[eoprot_endpoints_numberof][eoprot_entities_maxnumberofsupported+1];
 } eOprot_board_data_t;
 
 
@@ -82,6 +89,7 @@ static uint16_t s_eoprot_endpoint_numberofvariables_get(eOprotBRD_t brd, eOprotE
 static uint16_t s_eoprot_brdentityindex2ramoffset(eOprotBRD_t brd, uint8_t epi, eOprotEntity_t entity, eOprotIndex_t index);
 static uint16_t s_eoprot_brdid2ramoffset(eOprotBRD_t brd, uint8_t epi, eOprotID32_t id);
 static eObool_t s_eoprot_entity_tag_is_valid(uint8_t epi, eOprotEntity_t entity, eOprotTag_t tag);
+static void s_eoprot_prefixsums_compute(eOprot_board_data_t *data, uint8_t epi);
 
 static uint16_t s_eoprot_rom_get_offset(uint8_t epi, eOprotEntity_t entity, eOprotTag_t tag);
 
@@ -96,12 +104,20 @@ static eOresult_t s_eoprot_config_variable_callback(eOprotID32_t id, eOvoid_fp_c
 
 static eOprot_board_data_t* s_eoprot_board_data_get(eOprotBRD_t brd);
 
+static eOresult_t s_eoprot_config_board_reserve(eOprotBRD_t brd);
+
+static void s_eoprot_config_lock(void);
+static void s_eoprot_config_unlock(void);
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
 static eOprotBRD_t s_eoprot_localboard = eo_prot_BRDdummy; // initted as 255. however, in runtime we assign a specific number to it.
 
+// it serialises the functions which change the tables shared by all the boards (see s_eoprot_config_lock())
+static volatile uint32_t s_eoprot_config_lockword = 0;
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -112,7 +128,8 @@ static eOprotBRD_t s_eoprot_localboard = eo_prot_BRDdummy; // initted as 255. ho
 eOprot_board_data_t eoprot_loc_board_data = { NULL };
 
 #if     defined(EOPROT_CFG_REMOTE_BOARDS_USE_DYNAMIC_MODE)
-eOprot_board_data_t * eoprot_rem_board_data =  NULL ;
+// the data of a board is allocated at its first reservation and never moves, so that it can be used without any lock
+eOprot_board_data_t * eoprot_rem_board_data[eoprot_board_remotes_maxnumberof] = { NULL };
 uint8_t eoprot_rem_board_data_size = 0;
 #else
 eOprot_board_data_t eoprot_rem_board_data[eoprot_board_remotes_maxnumberof] = { NULL };
@@ -374,6 +391,17 @@ extern const eoprot_version_t * eoprot_version_of_endpoint_get(eOprotEndpoint_t
 }
 
 extern eOresult_t eoprot_config_board_reserve(eOprotBRD_t brd)
+{
+    eOresult_t res = eores_OK;
+    
+    s_eoprot_config_lock();
+    res = s_eoprot_config_board_reserve(brd);
+    s_eoprot_config_unlock();
+    
+    return(res);
+}
+
+static eOresult_t s_eoprot_config_board_reserve(eOprotBRD_t brd)
 {
     if(eoprot_board_localboard == brd)
     {
@@ -393,17 +421,25 @@ extern eOresult_t eoprot_config_board_reserve(eOprotBRD_t brd)
     }
     else
     {   
-        // ok. just realloc   
-        uint8_t oldsize = eoprot_rem_board_data_size;
-        eOprot_board_data_t *p = (eOprot_board_data_t*)realloc(eoprot_rem_board_data, (brd+1)*sizeof(eOprot_board_data_t));  
-        if(NULL == p)
+        // we allocate the boards up to brd which dont have data yet. the data of the other boards stays where it is
+        uint8_t b = 0;
+        for(b=eoprot_rem_board_data_size; b<=brd; b++)
         {
-            return(eores_NOK_generic);
+            eOprot_board_data_t *p = (eOprot_board_data_t*)calloc(1, sizeof(eOprot_board_data_t));
+            if(NULL == p)
+            {
+                return(eores_NOK_generic);
+            }
+            // the zeroed data must be visible before the pointer
+#if defined(EO_ATOMIC_AVAILABLE)
+            EO_atomic_barrier();
+#endif
+            eoprot_rem_board_data[b] = p;
         }
-        // if we can reallocate ...
+#if defined(EO_ATOMIC_AVAILABLE)
+        EO_atomic_barrier();
+#endif
         eoprot_rem_board_data_size = (brd+1);
-        eoprot_rem_board_data = p;        
-        memset(&eoprot_rem_board_data[oldsize], 0, (eoprot_rem_board_data_size-oldsize)*sizeof(eOprot_board_data_t));          
         return(eores_OK);
     }
     
@@ -440,7 +476,9 @@ extern eObool_t eoprot_board_can_be_managed(eOprotBRD_t brd)
 
 extern eOresult_t eoprot_config_board_local(eOprotBRD_t brd)
 {
+    s_eoprot_config_lock();
     s_eoprot_localboard = brd;
+    s_eoprot_config_unlock();
     return(eores_OK);
 }
 
@@ -463,6 +501,9 @@ extern eOresult_t eoprot_config_endpoint_entities(eOprotBRD_t brd, eOprotEndpoin
     epi = eoprot_ep_ep2index(ep);
             
     data->numberofeachentity[epi] = numberofentities;    
+    
+    // so that the offsets in ram and the prognums of the variables do not need to loop over the entities anymore
+    s_eoprot_prefixsums_compute(data, epi);
         
     return(res);
 }
@@ -490,11 +531,26 @@ extern eOresult_t eoprot_config_proxied_variables(eOprotBRD_t brd, eOprotEndpoin
     
     epi = eoprot_ep_ep2index(ep);
     
+    s_eoprot_config_lock();
     data->isvarproxied_fn[epi] = isvarproxied_fn;    
+    data->isvarproxied_changes ++;
+    s_eoprot_config_unlock();
     
     return(res);        
 }
 
+extern uint32_t eoprot_config_proxied_variables_changes_get(eOprotBRD_t brd)
+{
+    eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
+    
+    if(NULL == data)
+    {
+        return(0);
+    }
+    
+    return(data->isvarproxied_changes);
+}
+
 extern eObool_t eoprot_endpoint_configured_is(eOprotBRD_t brd, eOprotEndpoint_t ep)
 {
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
@@ -544,6 +600,8 @@ extern eOresult_t eoprot_config_callbacks_endpoint_set(const eOprot_callbacks_en
     
     raminitialise = cbkdes->raminitialise;
     
+    s_eoprot_config_lock();
+    
     switch(cbkdes->endpoint)
     {
         case eoprot_endpoint_management:
@@ -567,6 +625,7 @@ extern eOresult_t eoprot_config_callbacks_endpoint_set(const eOprot_callbacks_en
         break;
     };
     
+    s_eoprot_config_unlock();
         
     return(res);   
     
@@ -582,7 +641,9 @@ extern eOresult_t eoprot_config_onsay_endpoint_set(eOprotEndpoint_t ep, eOvoid_f
     }
     epindex = eoprot_ep_ep2index(ep);
     
+    s_eoprot_config_lock();
     eoprot_ep_onsay[epindex] = onsay;
+    s_eoprot_config_unlock();
 
     return(eores_OK);      
 }
@@ -607,13 +668,18 @@ extern eOresult_t eoprot_config_callbacks_variable_set(const eOprot_callbacks_va
     return(eores_NOK_generic);
 #else 
     eOprotID32_t id32 = 0;
+    eOresult_t res = eores_OK;
     if(NULL == cbkdes)
     {
         return(eores_NOK_generic);
     }
     id32 = eoprot_ID_get(cbkdes->endpoint, cbkdes->entity, 0, cbkdes->tag);
     
-    return(s_eoprot_config_variable_callback(id32, cbkdes->init, cbkdes->update));  
+    s_eoprot_config_lock();
+    res = s_eoprot_config_variable_callback(id32, cbkdes->init, cbkdes->update);
+    s_eoprot_config_unlock();
+    
+    return(res);  
 #endif    
 }
 
@@ -975,7 +1041,6 @@ extern uint16_t eoprot_endpoint_sizeof_get(eOprotBRD_t brd, eOprotEndpoint_t ep)
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
     uint16_t size = 0;
     uint8_t epi = 0;
-    uint8_t i;
     
     if(NULL == data)
     {
@@ -994,11 +1059,8 @@ extern uint16_t eoprot_endpoint_sizeof_get(eOprotBRD_t brd, eOprotEndpoint_t ep)
         return(0);
     }
     
-    
-    for(i=0; i<eoprot_ep_entities_numberof[epi]; i++)
-    {
-        size += eoprot_ep_entities_sizeof[epi][i] * data->numberofeachentity[epi][i];
-    }
+    // the prefix sum after the last entity is the size of all the entities
+    size = data->ramoffsetofentity[epi][eoprot_ep_entities_numberof[epi]];
     
     return(size);
 }
@@ -1028,11 +1090,41 @@ extern eOresult_t eoprot_config_endpoint_ram(eOprotBRD_t brd, eOprotEndpoint_t e
     epi = eoprot_ep_ep2index(ep);    
         
     data->ramofeachendpoint[epi] = ram;    
+    
+    if(NULL == ram)
+    {
+        data->onentityaccess_fn[epi] = NULL;
+        data->onentityaccess_arg[epi] = NULL;
+    }
         
     return(res);
 }
 
 
+extern eOresult_t eoprot_config_endpoint_onentityaccess(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprot_fp_onentityaccess_t fn, void* arg)
+{
+    eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
+    uint8_t epi = 0;
+         
+    if(NULL == data) 
+    {
+        return(eores_NOK_generic);
+    }
+    
+    if(ep >= eoprot_endpoints_numberof)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    epi = eoprot_ep_ep2index(ep);    
+        
+    data->onentityaccess_fn[epi] = fn;
+    data->onentityaccess_arg[epi] = (NULL == fn) ? (NULL) : (arg);
+        
+    return(eores_OK);
+}
+
+
 
 extern void* eoprot_variable_ramof_get(eOprotBRD_t brd, eOprotID32_t id)
 {
@@ -1068,6 +1160,11 @@ extern void* eoprot_variable_ramof_get(eOprotBRD_t brd, eOprotID32_t id)
     {
         return(NULL);
     }   
+    
+    if(NULL != data->onentityaccess_fn[epi])
+    {
+        data->onentityaccess_fn[epi](data->onentityaccess_arg[epi], brd, ep, eoprot_ID2entity(id), eoprot_ID2index(id));
+    }
 
     return(&startofdata[offset]);     
 }
@@ -1198,6 +1295,11 @@ extern void* eoprot_entity_ramof_get(eOprotBRD_t brd, eOprotEndpoint_t ep, eOpro
     {
         return(NULL);
     }   
+    
+    if(NULL != data->onentityaccess_fn[epi])
+    {
+        data->onentityaccess_fn[epi](data->onentityaccess_arg[epi], brd, ep, entity, index);
+    }
 
     return(&startofdata[offset]); 
 }
@@ -1315,7 +1417,10 @@ extern eOprotID32_t eoprot_endpoint_prognum2id(eOprotBRD_t brd, eOprotEndpoint_t
     eOprotIndex_t index = 0xff;
     eOprotEntity_t entity = 0xff;
     uint8_t epi = 0;
-    uint8_t i;
+    const uint16_t *prognumofentity = NULL;
+    uint8_t lo = 0;
+    uint8_t hi = 0;
+    uint8_t tags_number = 0;
      
     if(NULL == data)
     {
@@ -1334,24 +1439,37 @@ extern eOprotID32_t eoprot_endpoint_prognum2id(eOprotBRD_t brd, eOprotEndpoint_t
         return(EOK_uint32dummy);
     }
     
-       
-    for(i=0; i<eoprot_ep_entities_numberof[epi]; i++)
+    // the entity is the one whose range [prognumofentity[i], prognumofentity[i+1]) contains prog. we search it with a bisection
+    // of the prefix sums, which keeps prognumofentity[lo] <= prog < prognumofentity[hi]. the entities not present in the board
+    // have an empty range, thus they are never chosen.
+    prognumofentity = data->prognumofentity[epi];
+    hi = eoprot_ep_entities_numberof[epi];
+    
+    if(prog >= prognumofentity[hi])
     {
-        // starting from the first entity (if it present in the board) we progressively check if the signedprog is in its relevant range.
-        uint8_t tags_number_ith = eoprot_ep_tags_numberof[epi][i];
-        eOprotProgNumber_t progs_ith = tags_number_ith * data->numberofeachentity[epi][i]; // num of progs in all the entities i-th
-        if((0 != progs_ith) && (prog < (progs_ith)))
-        {   // entity is the i-th 
-            entity  = i;
-            index   = prog / tags_number_ith;       // tags_number_ith cannot be zero if progs_ith is non-zero
-            tag     = prog % tags_number_ith;  
-
-            return(eoprot_ID_get(ep, entity, index, tag));
+        return(EOK_uint32dummy);
+    }
+    
+    while((hi - lo) > 1)
+    {
+        uint8_t mid = (lo + hi) / 2;
+        if(prognumofentity[mid] <= prog)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
         }
-        prog -= progs_ith; // entity may be the next one. 
     }
-
-    return(EOK_uint32dummy);   
+    
+    entity      = lo;
+    prog       -= prognumofentity[entity];
+    tags_number = eoprot_ep_tags_numberof[epi][entity];     // it cannot be zero because the range of the entity is not empty
+    index       = prog / tags_number;
+    tag         = prog % tags_number;
+    
+    return(eoprot_ID_get(ep, entity, index, tag));
 }
 
 
@@ -1362,7 +1480,6 @@ extern eOprotProgNumber_t eoprot_endpoint_id2prognum(eOprotBRD_t brd, eOprotID32
     uint8_t epi = 0;
     eOprotEntity_t entity = eoprot_ID2entity(id);
     eOprotIndex_t  index  = eoprot_ID2index(id);
-    uint8_t i;
     eOprotEndpoint_t ep;
 
     if(NULL == data)
@@ -1390,16 +1507,123 @@ extern eOprotProgNumber_t eoprot_endpoint_id2prognum(eOprotBRD_t brd, eOprotID32
         return(EOK_uint32dummy);
     }
     
-    for(i=0; i<entity; i++)
-    {   // we add all the tags in the entities below
-        prog += (eoprot_ep_tags_numberof[epi][i] * data->numberofeachentity[epi][i]);
-    }
+    // we start from all the tags in the entities below
+    prog = data->prognumofentity[epi][entity];
     // then we add only the tags of the entities equal to the current one + the progressive number of the tag
     prog += (index*eoprot_ep_tags_numberof[epi][entity] + s_eoprot_rom_get_prognum(id));
 
     return(prog);
 }    
 
+extern eOresult_t eoprot_IDs_classify(eOprotBRD_t brd, const eOprotID32_t *ids, uint16_t numberofids, eOprot_IDsclassification_t *classification, eOprot_EPhistogram_t *histogram)
+{
+    eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
+    eOprot_IDsclassification_t cls = {NULL, NULL, NULL, NULL, NULL, NULL};
+    uint16_t i = 0;
+    
+    if(NULL == ids)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(NULL == data)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    if(NULL != classification)
+    {
+        cls = *classification;
+    }
+    
+    if(NULL != histogram)
+    {
+        memset(histogram, 0, sizeof(eOprot_EPhistogram_t));
+    }
+    
+    // - the fields: one loop for each of them, w/out any branch inside
+    
+    if(NULL != cls.endpoint)
+    {
+        for(i=0; i<numberofids; i++)
+        {
+            cls.endpoint[i] = (eOprotEndpoint_t)((ids[i]>>24) & 0xff);
+        }
+    }
+    
+    if(NULL != cls.entity)
+    {
+        for(i=0; i<numberofids; i++)
+        {
+            cls.entity[i] = (eOprotEntity_t)((ids[i]>>16) & 0xff);
+        }
+    }
+    
+    if(NULL != cls.index)
+    {
+        for(i=0; i<numberofids; i++)
+        {
+            cls.index[i] = (eOprotIndex_t)((ids[i]>>8) & 0xff);
+        }
+    }
+    
+    if(NULL != cls.tag)
+    {
+        for(i=0; i<numberofids; i++)
+        {
+            cls.tag[i] = (eOprotTag_t)(ids[i] & 0xff);
+        }
+    }
+    
+    // - validity and prognum. they depend on the configuration of the board, which we read directly.
+    
+    if((NULL == cls.prognum) && (NULL == cls.valid) && (NULL == histogram))
+    {
+        return(eores_OK);
+    }
+    
+    for(i=0; i<numberofids; i++)
+    {
+        eOprotEndpoint_t ep = (eOprotEndpoint_t)((ids[i]>>24) & 0xff);
+        eOprotEntity_t entity = (eOprotEntity_t)((ids[i]>>16) & 0xff);
+        eOprotIndex_t index = (eOprotIndex_t)((ids[i]>>8) & 0xff);
+        eOprotTag_t tag = (eOprotTag_t)(ids[i] & 0xff);
+        uint8_t epi = eoprot_ep_ep2index(ep);
+        uint16_t prognum = EOK_uint16dummy;
+        
+        if( (ep < eoprot_endpoints_numberof) && (NULL != data->numberofeachentity[epi]) &&
+            (entity < eoprot_ep_entities_numberof[epi]) && (index < data->numberofeachentity[epi][entity]) && 
+            (eobool_true == s_eoprot_entity_tag_is_valid(epi, entity, tag)) )
+        {
+            prognum = data->prognumofentity[epi][entity] + index*eoprot_ep_tags_numberof[epi][entity] + tag;
+        }
+        
+        if(NULL != cls.prognum)
+        {
+            cls.prognum[i] = prognum;
+        }
+        
+        if(NULL != cls.valid)
+        {
+            cls.valid[i] = (EOK_uint16dummy == prognum) ? (eobool_false) : (eobool_true);
+        }
+        
+        if(NULL != histogram)
+        {
+            if(EOK_uint16dummy == prognum)
+            {
+                histogram->invalid++;
+            }
+            else
+            {
+                histogram->endpoint[epi]++;
+            }
+        }
+    }
+    
+    return(eores_OK);
+}
+
 extern void* eoprot_endpoint_ramof_get(eOprotBRD_t brd, eOprotEndpoint_t ep)
 {
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
@@ -1446,7 +1670,6 @@ static uint16_t s_eoprot_endpoint_numberofvariables_get(eOprotBRD_t brd, eOprotE
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
     uint16_t num = 0;
     uint8_t epi = 0;
-    uint8_t i = 0;
 
     if(NULL == data)
     {
@@ -1465,12 +1688,8 @@ static uint16_t s_eoprot_endpoint_numberofvariables_get(eOprotBRD_t brd, eOprotE
         return(0);
     }
     
-    for(i=0; i<eoprot_ep_entities_numberof[epi]; i++)
-    {   
-        // simply the sum for each entity of the number of tags multiplied the number of each entity. 
-        // it also works if an entity is not present in the board
-        num += (eoprot_ep_tags_numberof[epi][i] * data->numberofeachentity[epi][i]);
-    }
+    // the prefix sum after the last entity is the number of variables of all the entities
+    num = data->prognumofentity[epi][eoprot_ep_entities_numberof[epi]];
 
     return(num);
 }
@@ -1479,7 +1698,6 @@ static uint16_t s_eoprot_brdentityindex2ramoffset(eOprotBRD_t brd, uint8_t epi,
 {
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
     uint16_t offset = 0;
-    uint8_t i = 0;
     
     if(NULL == data)
     {
@@ -1501,10 +1719,8 @@ static uint16_t s_eoprot_brdentityindex2ramoffset(eOprotBRD_t brd, uint8_t epi,
         return(EOK_uint16dummy);
     }
         
-    for(i=0; i<entity; i++)
-    {   // we sum the size of all the entities before the current one
-        offset += (data->numberofeachentity[epi][i] * eoprot_ep_entities_sizeof[epi][i]);
-    }
+    // the size of all the entities before the current one
+    offset = data->ramoffsetofentity[epi][entity];
     // then we add the offset of the current entity
     offset += (index*eoprot_ep_entities_sizeof[epi][entity]);
 
@@ -1541,28 +1757,35 @@ static eObool_t s_eoprot_entity_tag_is_valid(uint8_t epi, eOprotEntity_t entity,
 }
 
 
-// returns the offset of the variable with a given tag from the start of the entity
-static uint16_t s_eoprot_rom_entity_offset_of_tag(uint8_t epi, uint8_t ent, eOprotTag_t tag)
+static void s_eoprot_prefixsums_compute(eOprot_board_data_t *data, uint8_t epi)
 {
-    uint32_t i, tag_aux = 0;
-    uint8_t *one = NULL;
-    uint8_t *two = NULL;
-    int res = 0;
-
-    tag_aux = 0;
-    for(i=0; i<ent; i++)
+    uint8_t i = 0;
+    uint16_t ramoffset = 0;
+    uint16_t prognum = 0;
+    
+    for(i=0; i<eoprot_ep_entities_numberof[epi]; i++)
     {
-        tag_aux += eoprot_ep_tags_numberof[epi][i];
+        data->ramoffsetofentity[epi][i] = ramoffset;
+        data->prognumofentity[epi][i] = prognum;
+        
+        if(NULL != data->numberofeachentity[epi])
+        {   // it also works if an entity is not present in the board
+            ramoffset += (data->numberofeachentity[epi][i] * eoprot_ep_entities_sizeof[epi][i]);
+            prognum += (data->numberofeachentity[epi][i] * eoprot_ep_tags_numberof[epi][i]);
+        }
     }
-    // one contains the address of the default value of the entire entity (eg: &MYdefentity = 0x08001200).
-    one = (uint8_t*) eoprot_ep_entities_defval[epi][ent];
-    // two contains the address of the default value of the variable, but inside the default value of the entire entity (eg: &MYdefentity.var = 0x08001220)  
-    two = (uint8_t*) eoprot_ep_descriptors[epi][ent][tag]->resetval;
-    // if we want to know how many bytes they are fare aways we simply cast them to pointers of 1 byte and make the difference.
-    // the C standard assures that the result is an integer containing the distance between the pointers expressed in object pointed. in our case 1 byte.
-    res = two - one;
-    // and now we cast result to 16 bits because we dont have big entities.
-    return((uint16_t)res); 
+    
+    data->ramoffsetofentity[epi][i] = ramoffset;
+    data->prognumofentity[epi][i] = prognum;
+}
+
+
+// returns the offset of the variable with a given tag from the start of the entity
+static uint16_t s_eoprot_rom_entity_offset_of_tag(uint8_t epi, uint8_t ent, eOprotTag_t tag)
+{
+    // it was computed as the distance of eoprot_ep_descriptors[epi][ent][tag]->resetval from eoprot_ep_entities_defval[epi][ent].
+    // now the same value is inside a table filled by the compiler with offsetof()
+    return(eoprot_ep_tags_offset[epi][ent][tag]); 
 }
 
 static uint16_t s_eoprot_rom_get_offset(uint8_t epi, eOprotEntity_t entity, eOprotTag_t tag)
@@ -1652,6 +1875,26 @@ static eOresult_t s_eoprot_config_variable_callback(eOprotID32_t id, eOvoid_fp_c
 
 
 
+static void s_eoprot_config_lock(void)
+{
+    // a spinlock is enough because the protected sections are short and are executed only at configuration time.
+    // without atomics (the embedded targets) the configuration is done by a single task.
+#if defined(EO_ATOMIC_AVAILABLE)
+    while(!EO_atomic_cas32(&s_eoprot_config_lockword, 0, 1))
+    {
+        ;
+    }
+#endif
+}
+
+static void s_eoprot_config_unlock(void)
+{
+#if defined(EO_ATOMIC_AVAILABLE)
+    EO_atomic_barrier();
+    s_eoprot_config_lockword = 0;
+#endif
+}
+
 static eOprot_board_data_t* s_eoprot_board_data_get(eOprotBRD_t brd)
 {
     if(eoprot_board_localboard == brd)
@@ -1664,7 +1907,12 @@ static eOprot_board_data_t* s_eoprot_board_data_get(eOprotBRD_t brd)
     } 
     else
     {
-        return(&eoprot_rem_board_data[brd]);        
+#if     defined(EOPROT_CFG_REMOTE_BOARDS_USE_DYNAMIC_MODE)
+        // it may be NULL only if it is read concurrently with the eoprot_config_board_reserve() which allocates it
+        return(eoprot_rem_board_data[brd]);
+#else
+        return(&eoprot_rem_board_data[brd]);
+#endif
     }    
 }
 
@@ -28,6 +28,7 @@
 // --------------------------------------------------------------------------------------------------------------------
 
 #include "stdlib.h" 
+#include "stddef.h"
 #include "string.h"
 #include "stdio.h"
 
@@ -959,6 +960,103 @@ const void* const eoprot_as_rom_entities_defval[] =
 };  EO_VERIFYsizeof(eoprot_as_rom_entities_defval, eoprot_entities_as_numberof*sizeof(const void*)) 
 
 
+// the offset of each variable inside its entity in the order of the descriptors. it is the distance of the resetval
+// of a descriptor from the default value of its entity, but computed by the compiler.
+
+static const uint16_t s_eoprot_as_rom_strain_tags_offset[] =
+{
+    0,
+    offsetof(eOas_strain_t, config),
+    offsetof(eOas_strain_t, status),
+    offsetof(eOas_strain_t, status.fullscale),
+    offsetof(eOas_strain_t, status.calibratedvalues),
+    offsetof(eOas_strain_t, status.uncalibratedvalues)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_strain_tags_offset, eoprot_tags_as_strain_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_as_rom_mais_tags_offset[] =
+{
+    0,
+    offsetof(eOas_mais_t, config),
+    offsetof(eOas_mais_t, config.mode),
+    offsetof(eOas_mais_t, config.datarate),
+    offsetof(eOas_mais_t, config.resolution),
+    offsetof(eOas_mais_t, status),
+    offsetof(eOas_mais_t, status.the15values)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_mais_tags_offset, eoprot_tags_as_mais_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_as_rom_temperature_tags_offset[] =
+{
+    0,
+    offsetof(eOas_temperature_t, config),
+    offsetof(eOas_temperature_t, status),
+    offsetof(eOas_temperature_t, cmmnds.enable)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_temperature_tags_offset, eoprot_tags_as_temperature_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_as_rom_inertial_tags_offset[] =
+{
+    0,
+    offsetof(eOas_inertial_t, config),
+    offsetof(eOas_inertial_t, config.datarate),
+    offsetof(eOas_inertial_t, config.enabled),
+    offsetof(eOas_inertial_t, status),
+    offsetof(eOas_inertial_t, cmmnds.enable)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_inertial_tags_offset, eoprot_tags_as_inertial_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_as_rom_inertial3_tags_offset[] =
+{
+    0,
+    offsetof(eOas_inertial3_t, config),
+    offsetof(eOas_inertial3_t, status),
+    offsetof(eOas_inertial3_t, cmmnds.enable)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_inertial3_tags_offset, eoprot_tags_as_inertial3_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_as_rom_psc_tags_offset[] =
+{
+    0,
+    offsetof(eOas_psc_t, config),
+    offsetof(eOas_psc_t, status),
+    offsetof(eOas_psc_t, cmmnds.enable)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_psc_tags_offset, eoprot_tags_as_psc_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_as_rom_pos_tags_offset[] =
+{
+    0,
+    offsetof(eOas_pos_t, config),
+    offsetof(eOas_pos_t, status),
+    offsetof(eOas_pos_t, cmmnds.enable)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_pos_tags_offset, eoprot_tags_as_pos_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_as_rom_ft_tags_offset[] =
+{
+    offsetof(eOas_ft_t, config),
+    offsetof(eOas_ft_t, cmmnds.enable),
+    offsetof(eOas_ft_t, status),
+    offsetof(eOas_ft_t, status.timedvalue),
+    offsetof(eOas_ft_t, status.fullscale)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_ft_tags_offset, eoprot_tags_as_ft_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_as_rom_battery_tags_offset[] =
+{
+    offsetof(eOas_battery_t, config),
+    offsetof(eOas_battery_t, cmmnds.enable),
+    offsetof(eOas_battery_t, status),
+    offsetof(eOas_battery_t, status.timedvalue)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_battery_tags_offset, eoprot_tags_as_battery_numberof*sizeof(uint16_t))
+
+const uint16_t * const eoprot_as_rom_tags_offset[] = 
+{
+    s_eoprot_as_rom_strain_tags_offset,
+    s_eoprot_as_rom_mais_tags_offset,
+    s_eoprot_as_rom_temperature_tags_offset,
+    s_eoprot_as_rom_inertial_tags_offset,
+    s_eoprot_as_rom_inertial3_tags_offset,
+    s_eoprot_as_rom_psc_tags_offset,
+    s_eoprot_as_rom_pos_tags_offset,
+    s_eoprot_as_rom_ft_tags_offset,
+    s_eoprot_as_rom_battery_tags_offset
+};  EO_VERIFYsizeof(eoprot_as_rom_tags_offset, eoprot_entities_as_numberof*sizeof(const uint16_t*))
+
+
 // the strings of the endpoint
 
 const char * const eoprot_as_strings_entity[] =
@@ -145,6 +145,15 @@ const uint8_t* const eoprot_ep_tags_numberof[] =
     eoprot_sk_rom_tags_numberof
 };  EO_VERIFYsizeof(eoprot_ep_tags_numberof, eoprot_endpoints_numberof*sizeof(uint8_t*)) 
 
+// eoprot_ep_tags_offset[i][j][k] contains the offset of the tag k-th inside entity j-th of endpoint i-th 
+const uint16_t* const * const eoprot_ep_tags_offset[] =
+{   // very important: use order of eOprot_endpoint_t: pos 0 is eoprot_endpoint_management etc.
+    eoprot_mn_rom_tags_offset,
+    eoprot_mc_rom_tags_offset,
+    eoprot_as_rom_tags_offset,
+    eoprot_sk_rom_tags_offset
+};  EO_VERIFYsizeof(eoprot_ep_tags_offset, eoprot_endpoints_numberof*sizeof(uint16_t**)) 
+
 const char * const eoprot_strings_endpoint[eoprot_endpoints_numberof] =
 {   // very important: use order of eOprot_endpoint_t: pos 0 is eoprot_endpoint_management etc.
     "eoprot_endpoint_management",   
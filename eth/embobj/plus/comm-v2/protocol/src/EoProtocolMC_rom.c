@@ -28,6 +28,7 @@
 // --------------------------------------------------------------------------------------------------------------------
 
 #include "stdlib.h" 
+#include "stddef.h"
 #include "string.h"
 #include "stdio.h"
 
@@ -800,6 +801,67 @@ const void* const eoprot_mc_rom_entities_defval[] =
 };  EO_VERIFYsizeof(eoprot_mc_rom_entities_defval, eoprot_entities_mc_numberof*sizeof(const void*)) 
 
 
+// the offset of each variable inside its entity in the order of the descriptors. it is the distance of the resetval
+// of a descriptor from the default value of its entity, but computed by the compiler.
+
+static const uint16_t s_eoprot_mc_rom_joint_tags_offset[] =
+{
+    0,
+    offsetof(eOmc_joint_t, config),
+    offsetof(eOmc_joint_t, config.pidtrajectory),
+    offsetof(eOmc_joint_t, config.piddirect),
+    offsetof(eOmc_joint_t, config.pidtorque),
+    offsetof(eOmc_joint_t, config.userlimits),
+    offsetof(eOmc_joint_t, config.impedance),
+    offsetof(eOmc_joint_t, config.motor_params),
+    offsetof(eOmc_joint_t, config.tcfiltertype),
+    offsetof(eOmc_joint_t, status),
+    offsetof(eOmc_joint_t, status.core),
+    offsetof(eOmc_joint_t, status.target),
+    offsetof(eOmc_joint_t, status.core.modes.controlmodestatus),
+    offsetof(eOmc_joint_t, status.core.modes.interactionmodestatus),
+    offsetof(eOmc_joint_t, status.core.modes.ismotiondone),
+    offsetof(eOmc_joint_t, status.addinfo.multienc),
+    offsetof(eOmc_joint_t, status.debug),
+    offsetof(eOmc_joint_t, inputs),
+    offsetof(eOmc_joint_t, inputs.externallymeasuredtorque),
+    offsetof(eOmc_joint_t, cmmnds.calibration),
+    offsetof(eOmc_joint_t, cmmnds.setpoint),
+    offsetof(eOmc_joint_t, cmmnds.stoptrajectory),
+    offsetof(eOmc_joint_t, cmmnds.controlmode),
+    offsetof(eOmc_joint_t, cmmnds.interactionmode)
+};  EO_VERIFYsizeof(s_eoprot_mc_rom_joint_tags_offset, eoprot_tags_mc_joint_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_mc_rom_motor_tags_offset[] =
+{
+    0,
+    offsetof(eOmc_motor_t, config),
+    offsetof(eOmc_motor_t, config.currentLimits),
+    offsetof(eOmc_motor_t, config.gearbox_M2J),
+    offsetof(eOmc_motor_t, config.rotorEncoderResolution),
+    offsetof(eOmc_motor_t, config.pwmLimit),
+    offsetof(eOmc_motor_t, config.temperatureLimit),
+    offsetof(eOmc_motor_t, config.pidcurrent),
+    offsetof(eOmc_motor_t, config.pidspeed),
+    offsetof(eOmc_motor_t, status),
+    offsetof(eOmc_motor_t, status.basic)
+};  EO_VERIFYsizeof(s_eoprot_mc_rom_motor_tags_offset, eoprot_tags_mc_motor_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_mc_rom_controller_tags_offset[] =
+{
+    0,
+    offsetof(eOmc_controller_t, config),
+    offsetof(eOmc_controller_t, status)
+};  EO_VERIFYsizeof(s_eoprot_mc_rom_controller_tags_offset, eoprot_tags_mc_controller_numberof*sizeof(uint16_t))
+
+const uint16_t * const eoprot_mc_rom_tags_offset[] = 
+{
+    s_eoprot_mc_rom_joint_tags_offset,
+    s_eoprot_mc_rom_motor_tags_offset,
+    s_eoprot_mc_rom_controller_tags_offset
+};  EO_VERIFYsizeof(eoprot_mc_rom_tags_offset, eoprot_entities_mc_numberof*sizeof(const uint16_t*))
+
+
 // the strings of the endpoint
 
 const char * const eoprot_mc_strings_entity[] =
@@ -28,6 +28,7 @@
 // --------------------------------------------------------------------------------------------------------------------
 
 #include "stdlib.h" 
+#include "stddef.h"
 #include "string.h"
 #include "stdio.h"
 
@@ -544,6 +545,56 @@ const void* const eoprot_mn_rom_entities_defval[] =
 };  EO_VERIFYsizeof(eoprot_mn_rom_entities_defval, eoprot_entities_mn_numberof*sizeof(const void*)) 
 
 
+// the offset of each variable inside its entity in the order of the descriptors. it is the distance of the resetval
+// of a descriptor from the default value of its entity, but computed by the compiler.
+
+static const uint16_t s_eoprot_mn_rom_comm_tags_offset[] =
+{
+    0,
+    offsetof(eOmn_comm_t, status),
+    offsetof(eOmn_comm_t, status.managementprotocolversion),
+    offsetof(eOmn_comm_t, cmmnds.command.cmd.querynumof),
+    offsetof(eOmn_comm_t, cmmnds.command.cmd.queryarray),
+    offsetof(eOmn_comm_t, cmmnds.command.cmd.replynumof),
+    offsetof(eOmn_comm_t, cmmnds.command.cmd.replyarray),
+    offsetof(eOmn_comm_t, cmmnds.command.cmd.config)
+};  EO_VERIFYsizeof(s_eoprot_mn_rom_comm_tags_offset, eoprot_tags_mn_comm_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_mn_rom_appl_tags_offset[] =
+{
+    0,
+    offsetof(eOmn_appl_t, config),
+    offsetof(eOmn_appl_t, config.txratedivider),
+    offsetof(eOmn_appl_t, status),
+    offsetof(eOmn_appl_t, cmmnds.go2state),
+    offsetof(eOmn_appl_t, cmmnds.timeset)
+};  EO_VERIFYsizeof(s_eoprot_mn_rom_appl_tags_offset, eoprot_tags_mn_appl_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_mn_rom_info_tags_offset[] =
+{
+    0,
+    offsetof(eOmn_info_t, config),
+    offsetof(eOmn_info_t, config.enabled),
+    offsetof(eOmn_info_t, status),
+    offsetof(eOmn_info_t, status.basic)
+};  EO_VERIFYsizeof(s_eoprot_mn_rom_info_tags_offset, eoprot_tags_mn_info_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_mn_rom_service_tags_offset[] =
+{
+    0,
+    offsetof(eOmn_service_t, status.commandresult),
+    offsetof(eOmn_service_t, cmmnds.command)
+};  EO_VERIFYsizeof(s_eoprot_mn_rom_service_tags_offset, eoprot_tags_mn_service_numberof*sizeof(uint16_t))
+
+const uint16_t * const eoprot_mn_rom_tags_offset[] = 
+{
+    s_eoprot_mn_rom_comm_tags_offset,
+    s_eoprot_mn_rom_appl_tags_offset,
+    s_eoprot_mn_rom_info_tags_offset,
+    s_eoprot_mn_rom_service_tags_offset
+};  EO_VERIFYsizeof(eoprot_mn_rom_tags_offset, eoprot_entities_mn_numberof*sizeof(const uint16_t*))
+
+
 // the strings of the endpoint
 
 const char * const eoprot_mn_strings_entity[] =
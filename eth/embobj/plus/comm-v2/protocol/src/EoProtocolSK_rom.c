@@ -28,6 +28,7 @@
 // --------------------------------------------------------------------------------------------------------------------
 
 #include "stdlib.h" 
+#include "stddef.h"
 #include "string.h"
 #include "stdio.h"
 
@@ -217,6 +218,24 @@ const void* const eoprot_sk_rom_entities_defval[] =
     (const void*)&eoprot_sk_rom_skin_defaultvalue
 };  EO_VERIFYsizeof(eoprot_sk_rom_entities_defval, eoprot_entities_sk_numberof*sizeof(const void*)) 
 
+
+// the offset of each variable inside its entity in the order of the descriptors. it is the distance of the resetval
+// of a descriptor from the default value of its entity, but computed by the compiler.
+
+static const uint16_t s_eoprot_sk_rom_skin_tags_offset[] =
+{
+    0,
+    offsetof(eOsk_skin_t, config.sigmode),
+    offsetof(eOsk_skin_t, status.arrayofcandata),
+    offsetof(eOsk_skin_t, cmmnds.boardscfg),
+    offsetof(eOsk_skin_t, cmmnds.trianglescfg)
+};  EO_VERIFYsizeof(s_eoprot_sk_rom_skin_tags_offset, eoprot_tags_sk_skin_numberof*sizeof(uint16_t))
+
+const uint16_t * const eoprot_sk_rom_tags_offset[] = 
+{
+    s_eoprot_sk_rom_skin_tags_offset
+};  EO_VERIFYsizeof(eoprot_sk_rom_tags_offset, eoprot_entities_sk_numberof*sizeof(const uint16_t*))
+
 // the strings of the endpoint
 
 const char * const eoprot_sk_strings_entity[] =
@@ -233,6 +233,50 @@ extern eOresult_t eo_agent_InpROPprocess(EOagent *p, EOrop *ropin, eOipv4addr_t
 }
 
 
+extern eOresult_t eo_agent_InpROPprocessView(EOagent *p, const eOropdescriptor_t *ropdes)
+{
+    EOnv nv;
+    
+    if((NULL == p) || (NULL == ropdes))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    // only sig<> and say<> w/out confirmations: they never have a reply rop
+    if((eo_ropcode_sig != ropdes->ropcode) && (eo_ropcode_say != ropdes->ropcode))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    if((1 == ropdes->control.rqstconf) || (eo_ropconf_none != ropdes->control.confinfo))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    if(eores_OK != eo_nvset_NV_Get(p->config.nvset, ropdes->id32, &nv))
+    {   // as in eo_agent_InpROPprocess(): w/out confirmation request there is nothing to do on a not existing netvar
+        return(eores_OK);
+    }
+    
+    // the data is not copied into a zero padded EOrop, thus it must cover the whole netvar. 
+    // and the forward to the proxy needs an EOrop.
+    if((ropdes->size < eo_nv_Size(&nv)) || ((eobool_true == eo_nv_IsProxied(&nv)) && (NULL != p->config.proxy) && (eo_nv_ownership_local == eo_nv_GetOwnership(&nv))))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    // same as s_eo_agent_rop_exec()
+    eo_nv_hid_remoteSetROP(&nv, ropdes->data, eo_nv_upd_always, ropdes);
+    
+    if(eo_ropcode_say == ropdes->ropcode)
+    {
+        eo_nv_hid_OnSay(&nv, ropdes);
+    }
+    
+    return(eores_OK);
+}
+
+
 
 extern eOresult_t eo_agent_OutROPprepare(EOagent* p, EOnv* nv, eOropdescriptor_t* ropdescr, EOrop* rop, uint16_t* requiredbytes)
 {
@@ -97,6 +97,11 @@ extern EOproxy* eo_agent_GetProxy(EOagent *p);
 // it may produce a rop in output. the rop in output must not be fed to eo_agent_OutROPinit() or eo_agent_OutROPfill()
 extern eOresult_t eo_agent_InpROPprocess(EOagent *p, EOrop *ropin, eOipv4addr_t fromipaddr, EOrop *replyrop);
 
+// fast path of eo_agent_InpROPprocess() for a rop decoded in place with eo_ropframe_ROP_Peek(). it processes only what
+// surely does not need a reply: sig<> and say<> without confirmation request. it returns eores_NOK_generic without 
+// doing anything for every other rop, which then must be processed with eo_agent_InpROPprocess().
+extern eOresult_t eo_agent_InpROPprocessView(EOagent *p, const eOropdescriptor_t *ropdes);
+
 // OK: called by eo_transmitter_occasional_rops_Load() and eo_transmitter_regular_rops_Load(). 
 // if data is required this function uses ropdescr->data/size if not NULL/0, otherwise if NULL it used data from EOnv.
 extern eOresult_t eo_agent_OutROPprepare(EOagent* p, EOnv* nv, eOropdescriptor_t* ropdescr, EOrop* rop, uint16_t* requiredbytes);
@@ -142,6 +142,7 @@ extern EOdeviceTransceiver * eo_devicetransceiver_New(const eOdevicetransceiver_
     txrxcfg.sizes.capacityofropframeoccasionals = cfg->sizes.capacityofropframeoccasionals;
     txrxcfg.sizes.capacityofropframereplies     = cfg->sizes.capacityofropframereplies;
     txrxcfg.sizes.maxnumberofregularrops        = cfg->sizes.maxnumberofregularrops;
+    txrxcfg.sizes.maxnumberofstagedrops         = cfg->sizes.maxnumberofstagedrops;
     txrxcfg.remipv4addr                         = cfg->remotehostipv4addr;
     txrxcfg.remipv4port                         = cfg->remotehostipv4port;
     txrxcfg.nvset                               = retptr->nvset;
@@ -29,6 +29,14 @@
 #include "EOnv_hid.h"
 #include "EOrop_hid.h"
 
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+#include "sys/mman.h"
+#include "sys/stat.h"
+#include "fcntl.h"
+#include "unistd.h"
+#include "pthread.h"
+#endif
+
 
 
 
@@ -49,7 +57,12 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+#if defined(EO_ATOMIC_AVAILABLE)
+    #define EOHOSTTRANSCEIVER_SHM_BARRIER()     EO_atomic_barrier()
+#else
+    #define EOHOSTTRANSCEIVER_SHM_BARRIER()
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -62,17 +75,33 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// the work shared by the threads of eo_hosttransceiver_NewBatch(): each one takes the next cfg until they are finished
+typedef struct
+{
+    const eOhosttransceiver_cfg_t*  cfgs;
+    EOhostTransceiver**             transceivers;
+    uint16_t                        number;
+    volatile uint32_t               next;
+} eOhosttransceiver_batch_t;
+
+enum { eo_hosttransceiver_batch_maxworkers = 64 };
 
 
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
 
-static EOnvSet* s_eo_hosttransceiver_nvset_get(const eOhosttransceiver_cfg_t *cfg);
+static EOnvSet* s_eo_hosttransceiver_nvset_get(EOhostTransceiver *p, const eOhosttransceiver_cfg_t *cfg);
+
+static void* s_eo_hosttransceiver_shm_epram_get(void* arg, eOnvBRD_t brd, eOnvEP8_t ep, uint16_t sizeofram, volatile uint32_t** entityseqlocks);
+
+static void s_eo_hosttransceiver_shm_epram_release(void* arg, eOnvBRD_t brd, eOnvEP8_t ep, void* ram);
 
 static void s_eo_hosttransceiver_nvset_release(EOhostTransceiver *p);
 
+static void* s_eo_hosttransceiver_batch_worker(void* arg);
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -93,7 +122,8 @@ const eOhosttransceiver_cfg_t eo_hosttransceiver_cfg_default =
         EO_INIT(.capacityofropframeregulars)        EOK_HOSTTRANSCEIVER_capacityofropframeregulars,
         EO_INIT(.capacityofropframeoccasionals)     EOK_HOSTTRANSCEIVER_capacityofropframeoccasionals,
         EO_INIT(.capacityofropframereplies)         EOK_HOSTTRANSCEIVER_capacityofropframereplies,
-        EO_INIT(.maxnumberofregularrops)            EOK_HOSTTRANSCEIVER_maxnumberofregularrops       
+        EO_INIT(.maxnumberofregularrops)            EOK_HOSTTRANSCEIVER_maxnumberofregularrops,
+        EO_INIT(.maxnumberofstagedrops)             EOK_HOSTTRANSCEIVER_maxnumberofstagedrops
     },    
     EO_INIT(.mutex_fn_new)              NULL,
     EO_INIT(.transprotection)           eo_trans_protection_none,
@@ -103,7 +133,10 @@ const eOhosttransceiver_cfg_t eo_hosttransceiver_cfg_default =
     {
         EO_INIT(.onerrorseqnumber)      NULL,
         EO_INIT(.onerrorinvalidframe)   NULL
-    }    
+    },
+    EO_INIT(.sharedmemoryname)          NULL,
+    EO_INIT(.nvsetlazyinit)             eobool_false,
+    EO_INIT(.transceiverarena)          eobool_false
 };
 
 
@@ -129,10 +162,12 @@ extern EOhostTransceiver * eo_hosttransceiver_New(const eOhosttransceiver_cfg_t
     }  
     
     retptr = (EOhostTransceiver*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOhostTransceiver), 1);
+    
+    retptr->ipaddressofboard = cfg->remoteboardipv4addr;
 
     // 1. init the proper transceiver cfg
 
-    retptr->nvset = s_eo_hosttransceiver_nvset_get(cfg);
+    retptr->nvset = s_eo_hosttransceiver_nvset_get(retptr, cfg);
     
 
     txrxcfg.sizes.capacityoftxpacket            = cfg->sizes.capacityoftxpacket;
@@ -141,6 +176,7 @@ extern EOhostTransceiver * eo_hosttransceiver_New(const eOhosttransceiver_cfg_t
     txrxcfg.sizes.capacityofropframeoccasionals = cfg->sizes.capacityofropframeoccasionals;
     txrxcfg.sizes.capacityofropframereplies     = cfg->sizes.capacityofropframereplies;
     txrxcfg.sizes.maxnumberofregularrops        = cfg->sizes.maxnumberofregularrops;
+    txrxcfg.sizes.maxnumberofstagedrops         = cfg->sizes.maxnumberofstagedrops;
     txrxcfg.remipv4addr                         = cfg->remoteboardipv4addr;
     txrxcfg.remipv4port                         = cfg->remoteboardipv4port;
     txrxcfg.nvset                               = retptr->nvset; 
@@ -149,13 +185,12 @@ extern EOhostTransceiver * eo_hosttransceiver_New(const eOhosttransceiver_cfg_t
     txrxcfg.mutex_fn_new                        = cfg->mutex_fn_new;
     txrxcfg.protection                          = cfg->transprotection;
     memcpy(&txrxcfg.extfn, &cfg->extfn, sizeof(eOtransceiver_extfn_t));
+    txrxcfg.arena                               = cfg->transceiverarena;
 
     
     
     retptr->transceiver = eo_transceiver_New(&txrxcfg);
     
-    retptr->ipaddressofboard = cfg->remoteboardipv4addr;
-    
     eo_nvset_BRD_Get(retptr->nvset, &retptr->boardnumber);
     
     return(retptr);        
@@ -185,6 +220,116 @@ extern void eo_hosttransceiver_Delete(EOhostTransceiver *p)
 }    
 
 
+extern eOresult_t eo_hosttransceiver_NewBatch(const eOhosttransceiver_cfg_t *cfgs, uint16_t number, uint16_t numberofworkers, EOhostTransceiver **transceivers)
+{
+    eOhosttransceiver_batch_t batch = {0};
+    uint32_t boards[256/32] = {0};
+    eOnvBRD_t highestboard = 0;
+    uint16_t i = 0;
+    
+    if((NULL == cfgs) || (NULL == transceivers))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    // we verify everything before we start, so that the workers never stop on an error. 
+    for(i=0; i<number; i++)
+    {
+        eOnvBRD_t brd = 0;
+        transceivers[i] = NULL;
+        if(NULL == cfgs[i].nvsetbrdcfg)
+        {
+            return(eores_NOK_generic);
+        }
+        brd = cfgs[i].nvsetbrdcfg->boardnum;
+        if(0 != (boards[brd >> 5] & (1u << (brd & 31))))
+        {   // two transceivers would configure the same board of eoprot
+            return(eores_NOK_generic);
+        }
+        boards[brd >> 5] |= (1u << (brd & 31));
+        highestboard = (brd > highestboard) ? (brd) : (highestboard);
+    }
+    
+    // the reservation of the boards is done now, so that it fails before anything is created
+    if((number > 0) && (eoprot_board_localboard != highestboard) && (eores_OK != eoprot_config_board_reserve(highestboard)))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    batch.cfgs          = cfgs;
+    batch.transceivers  = transceivers;
+    batch.number        = number;
+    batch.next          = 0;
+    
+#if defined(EO_TAILOR_CODE_FOR_LINUX) && defined(EO_ATOMIC_AVAILABLE)
+    if(0 == numberofworkers)
+    {
+        long ncores = sysconf(_SC_NPROCESSORS_ONLN);
+        numberofworkers = (ncores > 0) ? ((uint16_t)ncores) : (1);
+    }
+    if(numberofworkers > number)
+    {
+        numberofworkers = number;
+    }
+    if(numberofworkers > eo_hosttransceiver_batch_maxworkers)
+    {
+        numberofworkers = eo_hosttransceiver_batch_maxworkers;
+    }
+    if(eobool_false == eo_mempool_IsDeleteSupported(eo_mempool_GetHandle()))
+    {   // the static pools may not have a mutex. the dynamic and the slab modes are thread-safe (see eo_mempool_GetMemory())
+        numberofworkers = 1;
+    }
+    
+    if(numberofworkers > 1)
+    {
+        pthread_t workers[eo_hosttransceiver_batch_maxworkers];
+        eObool_t started[eo_hosttransceiver_batch_maxworkers] = {0};
+        // the calling thread is a worker as well, so that the work is done even if no thread can be started
+        for(i=1; i<numberofworkers; i++)
+        {
+            started[i] = (0 == pthread_create(&workers[i], NULL, s_eo_hosttransceiver_batch_worker, &batch)) ? (eobool_true) : (eobool_false);
+        }
+        s_eo_hosttransceiver_batch_worker(&batch);
+        for(i=1; i<numberofworkers; i++)
+        {
+            if(eobool_true == started[i])
+            {
+                pthread_join(workers[i], NULL);
+            }
+        }
+    }
+    else
+#endif
+    {
+        numberofworkers = numberofworkers;
+        for(i=0; i<number; i++)
+        {
+            transceivers[i] = eo_hosttransceiver_New(&cfgs[i]);
+        }
+    }
+    
+    for(i=0; i<number; i++)
+    {
+        if(NULL == transceivers[i])
+        {
+            break;
+        }
+    }
+    
+    if(i < number)
+    {   // we dont keep the ones which were created
+        for(i=0; i<number; i++)
+        {
+            eo_hosttransceiver_Delete(transceivers[i]);
+            transceivers[i] = NULL;
+        }
+        return(eores_NOK_generic);
+    }
+    
+    return(eores_OK);
+}
+
+
 extern EOtransceiver* eo_hosttransceiver_GetTransceiver(EOhostTransceiver *p)
 {
     if(NULL == p)
@@ -228,6 +373,128 @@ extern eOipv4addr_t eo_hosttransceiver_GetRemoteIP(EOhostTransceiver* p)
 }
 
 
+extern eOresult_t eo_hosttransceiver_shm_Name_Get(const char* sharedmemoryname, eOnvBRD_t brd, eOnvEP8_t ep, char* name, uint16_t size)
+{
+    int n = 0;
+    
+    if((NULL == sharedmemoryname) || (NULL == name))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    n = snprintf(name, size, "%s%s.%d.%d", ('/' == sharedmemoryname[0]) ? ("") : ("/"), sharedmemoryname, brd, ep);
+    
+    return(((n < 0) || (n >= size)) ? (eores_NOK_generic) : (eores_OK));
+}
+
+
+extern const eOhosttransceiver_shm_header_t* eo_hosttransceiver_shm_Map(const char* name)
+{
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+    const eOhosttransceiver_shm_header_t* shm = NULL;
+    struct stat st;
+    void* mem = NULL;
+    int fd = -1;
+    
+    if(NULL == name)
+    {
+        return(NULL);
+    }
+    
+    fd = shm_open(name, O_RDONLY, 0);
+    if(fd < 0)
+    {
+        return(NULL);
+    }
+    
+    if((0 != fstat(fd, &st)) || (st.st_size < (off_t)sizeof(eOhosttransceiver_shm_header_t)))
+    {
+        close(fd);
+        return(NULL);
+    }
+    
+    mem = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(MAP_FAILED == mem)
+    {
+        return(NULL);
+    }
+    
+    shm = (const eOhosttransceiver_shm_header_t*) mem;
+    if((eo_hosttransceiver_shm_magic != shm->magic) || (eo_hosttransceiver_shm_version != shm->version) || ((off_t)(shm->offsetofram + shm->sizeofram) > st.st_size))
+    {
+        munmap(mem, st.st_size);
+        return(NULL);
+    }
+    
+    return(shm);
+#else
+    name = name;
+    return(NULL);
+#endif
+}
+
+
+extern void eo_hosttransceiver_shm_Unmap(const eOhosttransceiver_shm_header_t* shm)
+{
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+    if(NULL != shm)
+    {
+        munmap((void*)shm, shm->offsetofram + shm->sizeofram);
+    }
+#else
+    shm = shm;
+#endif
+}
+
+
+extern eOresult_t eo_hosttransceiver_shm_Entity_Read(const eOhosttransceiver_shm_header_t* shm, eOprotEntity_t entity, eOprotIndex_t index, void* dest, uint16_t size)
+{
+    enum { maxretries = 1000 };
+    const volatile uint32_t* seqlock = NULL;
+    const uint8_t* source = NULL;
+    uint16_t i = 0;
+    uint16_t first = 0;
+    uint16_t retries = 0;
+    
+    if((NULL == shm) || (NULL == dest))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if((entity >= eoprot_entities_maxnumberofsupported) || (index >= shm->numberofentities[entity]) || (size < shm->sizeofentity[entity]))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    for(i=0; i<entity; i++)
+    {
+        first += shm->numberofentities[i];
+    }
+    
+    seqlock = (const volatile uint32_t*) ((const uint8_t*)shm + shm->offsetofseqlocks) + first + index;
+    source = (const uint8_t*)shm + shm->offsetofram + shm->offsetofentity[entity] + index*shm->sizeofentity[entity];
+    
+    for(retries=0; retries<maxretries; retries++)
+    {
+        uint32_t before = *seqlock;
+        if(0 != (before & 1))
+        {   // a write is in progress
+            continue;
+        }
+        EOHOSTTRANSCEIVER_SHM_BARRIER();
+        memcpy(dest, source, shm->sizeofentity[entity]);
+        EOHOSTTRANSCEIVER_SHM_BARRIER();
+        if(before == *seqlock)
+        {
+            return(eores_OK);
+        }
+    }
+    
+    return(eores_NOK_busy);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -238,9 +505,32 @@ extern eOipv4addr_t eo_hosttransceiver_GetRemoteIP(EOhostTransceiver* p)
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
 
-static EOnvSet* s_eo_hosttransceiver_nvset_get(const eOhosttransceiver_cfg_t *cfg)
+static EOnvSet* s_eo_hosttransceiver_nvset_get(EOhostTransceiver *p, const eOhosttransceiver_cfg_t *cfg)
 {
     EOnvSet* nvset = eo_nvset_New(cfg->nvsetprotection, cfg->mutex_fn_new);    
+    
+    if(eobool_true == cfg->nvsetlazyinit)
+    {
+        eo_nvset_LazyInit_Enable(nvset);
+    }
+    
+    memset(p->shmname, 0, sizeof(p->shmname));
+    memset(p->shmsegment, 0, sizeof(p->shmsegment));
+    memset(p->shmsizeofsegment, 0, sizeof(p->shmsizeofsegment));
+    if(NULL != cfg->sharedmemoryname)
+    {
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+        eOnvset_EPramprovider_t provider = {0};
+        provider.get        = s_eo_hosttransceiver_shm_epram_get;
+        provider.release    = s_eo_hosttransceiver_shm_epram_release;
+        provider.arg        = p;
+        snprintf(p->shmname, sizeof(p->shmname), "%s", cfg->sharedmemoryname);
+        eo_nvset_EPramProvider_Set(nvset, &provider);
+#else
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "s_eo_hosttransceiver_nvset_get(): shared memory is not supported", s_eobj_ownname, &eo_errman_DescrUnspecified);
+#endif
+    }
+    
     eo_nvset_InitBRD_LoadEPs(nvset, eo_nvset_ownership_remote, cfg->remoteboardipv4addr, (eOnvset_BRDcfg_t*)cfg->nvsetbrdcfg, eobool_true);   
     return(nvset);
 }
@@ -259,6 +549,133 @@ static void s_eo_hosttransceiver_nvset_release(EOhostTransceiver *p)
     p->nvset = NULL;  
 }
 
+
+static void* s_eo_hosttransceiver_batch_worker(void* arg)
+{
+#if defined(EO_ATOMIC_AVAILABLE)
+    eOhosttransceiver_batch_t* batch = (eOhosttransceiver_batch_t*)arg;
+    
+    for(;;)
+    {
+        uint32_t i = batch->next;
+        if(i >= batch->number)
+        {
+            break;
+        }
+        if(EO_atomic_cas32(&batch->next, i, i+1))
+        {
+            batch->transceivers[i] = eo_hosttransceiver_New(&batch->cfgs[i]);
+        }
+    }
+#else
+    arg = arg;
+#endif
+    return(NULL);
+}
+
+
+static void* s_eo_hosttransceiver_shm_epram_get(void* arg, eOnvBRD_t brd, eOnvEP8_t ep, uint16_t sizeofram, volatile uint32_t** entityseqlocks)
+{
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+    EOhostTransceiver *p = (EOhostTransceiver*)arg;
+    eOhosttransceiver_shm_header_t header = {0};
+    char name[eo_hosttransceiver_shm_namesize] = {0};
+    uint8_t* mem = NULL;
+    uint32_t sizeofsegment = 0;
+    uint16_t ent = 0;
+    uint16_t offset = 0;
+    int fd = -1;
+    
+    if((ep >= eoprot_endpoints_numberof) || (eores_OK != eo_hosttransceiver_shm_Name_Get(p->shmname, brd, ep, name, sizeof(name))))
+    {
+        return(NULL);
+    }
+    
+    // the entities are placed in the ram of the endpoint one after another in order of entity
+    header.version          = eo_hosttransceiver_shm_version;
+    header.board            = brd;
+    header.endpoint         = ep;
+    header.ipv4addr         = p->ipaddressofboard;
+    header.sizeofram        = sizeofram;
+    for(ent=0; ent<eoprot_entities_maxnumberofsupported; ent++)
+    {
+        header.numberofentities[ent]    = eoprot_entity_numberof_get(brd, ep, ent);
+        header.sizeofentity[ent]        = (0 == header.numberofentities[ent]) ? (0) : (eoprot_entity_sizeof_get(brd, ep, ent));
+        header.offsetofentity[ent]      = offset;
+        header.numberofseqlocks        += header.numberofentities[ent];
+        offset                         += header.numberofentities[ent] * header.sizeofentity[ent];
+    }
+    header.offsetofseqlocks = (sizeof(eOhosttransceiver_shm_header_t) + 7) & ~7;
+    header.offsetofram      = (header.offsetofseqlocks + header.numberofseqlocks*sizeof(uint32_t) + 7) & ~7;
+    sizeofsegment           = header.offsetofram + sizeofram;
+    
+    // a segment left by a previous run is removed so that its readers keep their old copy
+    shm_unlink(name);
+    fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if(fd < 0)
+    {
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "s_eo_hosttransceiver_shm_epram_get(): cannot create the segment", s_eobj_ownname, &eo_errman_DescrUnspecified);
+        return(NULL);
+    }
+    
+    if(0 != ftruncate(fd, sizeofsegment))
+    {
+        close(fd);
+        shm_unlink(name);
+        return(NULL);
+    }
+    
+    mem = (uint8_t*) mmap(NULL, sizeofsegment, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if((void*)MAP_FAILED == (void*)mem)
+    {
+        shm_unlink(name);
+        return(NULL);
+    }
+    
+    // the magic number is written last, so that a reader never maps a segment with an incomplete header
+    memcpy(mem, &header, sizeof(header));
+    EOHOSTTRANSCEIVER_SHM_BARRIER();
+    ((eOhosttransceiver_shm_header_t*)mem)->magic = eo_hosttransceiver_shm_magic;
+    
+    p->shmsegment[ep]       = mem;
+    p->shmsizeofsegment[ep] = sizeofsegment;
+    
+    *entityseqlocks = (volatile uint32_t*) (mem + header.offsetofseqlocks);
+    return(mem + header.offsetofram);
+#else
+    arg = arg; brd = brd; ep = ep; sizeofram = sizeofram; entityseqlocks = entityseqlocks;
+    return(NULL);
+#endif
+}
+
+
+static void s_eo_hosttransceiver_shm_epram_release(void* arg, eOnvBRD_t brd, eOnvEP8_t ep, void* ram)
+{
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+    EOhostTransceiver *p = (EOhostTransceiver*)arg;
+    char name[eo_hosttransceiver_shm_namesize] = {0};
+    
+    ram = ram;
+    
+    if((ep >= eoprot_endpoints_numberof) || (NULL == p->shmsegment[ep]))
+    {
+        return;
+    }
+    
+    munmap(p->shmsegment[ep], p->shmsizeofsegment[ep]);
+    p->shmsegment[ep]       = NULL;
+    p->shmsizeofsegment[ep] = 0;
+    
+    if(eores_OK == eo_hosttransceiver_shm_Name_Get(p->shmname, brd, ep, name, sizeof(name)))
+    {
+        shm_unlink(name);
+    }
+#else
+    arg = arg; brd = brd; ep = ep; ram = ram;
+#endif
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
 // --------------------------------------------------------------------------------------------------------------------
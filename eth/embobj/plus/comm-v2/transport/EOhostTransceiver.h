@@ -62,6 +62,9 @@ extern "C" {
 #define EOK_HOSTTRANSCEIVER_capacityofropframeoccasionals      (EOK_HOSTTRANSCEIVER_capacityoftxpacket - EOK_HOSTTRANSCEIVER_TMP)
 #define EOK_HOSTTRANSCEIVER_maxnumberofregularrops             0
 #define EOK_HOSTTRANSCEIVER_maxnumberofconfreqrops             16
+// the lock-free staging of occasionals and replies is opt-in. if it is not zero, eo_transceiver_NumberofOutROPs() moves the staged 
+// rops into their ropframes, thus it must be called by the same thread which calls eo_transceiver_outpacket_Prepare().
+#define EOK_HOSTTRANSCEIVER_maxnumberofstagedrops              0
 
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
 
@@ -76,9 +79,38 @@ typedef struct
     eOnvset_protection_t            nvsetprotection; 
     eOconfman_cfg_t*                confmancfg;
     eOtransceiver_extfn_t           extfn;
+    const char*                     sharedmemoryname;   // if not NULL, the ram of the endpoints is placed in posix shared memory (see below)
+    eObool_t                        nvsetlazyinit;      // if eobool_true, the nvs of an entity are initialised at its first access (see eo_nvset_LazyInit_Enable())
+    eObool_t                        transceiverarena;   // if eobool_true, the EOtransceiver is placed in a single block (see eo_transceiver_ArenaSize_Get())
 } eOhosttransceiver_cfg_t;
 
 
+// if eOhosttransceiver_cfg_t::sharedmemoryname is not NULL, the ram of each endpoint of the board is placed in a posix shared 
+// memory segment named as in eo_hosttransceiver_shm_Name_Get(), so that other processes on the same host can read the values 
+// received from the board without asking for them. the segment contains a eOhosttransceiver_shm_header_t, then a uint32_t
+// sequence counter for each entity (ordered by entity and then by index) and then the ram of the endpoint. the counter of an 
+// entity is odd while the transceiver writes one of its variables, hence eo_hosttransceiver_shm_Entity_Read() copies an entity
+// until the counter is even and unchanged. it is supported only on linux, elsewhere the ram stays in the heap.
+
+enum { eo_hosttransceiver_shm_magic = 0x4d484545, eo_hosttransceiver_shm_version = 1, eo_hosttransceiver_shm_namesize = 64 };
+
+typedef struct
+{
+    uint32_t                        magic;              // eo_hosttransceiver_shm_magic once the segment is ready
+    uint16_t                        version;
+    uint8_t                         board;
+    uint8_t                         endpoint;
+    eOipv4addr_t                    ipv4addr;
+    uint16_t                        sizeofram;
+    uint16_t                        numberofseqlocks;
+    uint32_t                        offsetofseqlocks;   // from the start of the segment
+    uint32_t                        offsetofram;        // from the start of the segment
+    uint8_t                         numberofentities[eoprot_entities_maxnumberofsupported];
+    uint16_t                        sizeofentity[eoprot_entities_maxnumberofsupported];
+    uint16_t                        offsetofentity[eoprot_entities_maxnumberofsupported];   // from the start of the ram
+} eOhosttransceiver_shm_header_t;
+
+
 
 /** @typedef    typedef struct EOhostTransceiver_hid EOhostTransceiver
     @brief      EOhostTransceiver is an opaque struct. It is used to implement data abstraction for the Parser  
@@ -109,6 +141,21 @@ extern EOhostTransceiver * eo_hosttransceiver_New(const eOhosttransceiver_cfg_t
 extern void eo_hosttransceiver_Delete(EOhostTransceiver *p);
 
 
+/** @fn         extern eOresult_t eo_hosttransceiver_NewBatch(const eOhosttransceiver_cfg_t *cfgs, uint16_t number, uint16_t numberofworkers, EOhostTransceiver **transceivers)
+    @brief      It creates number EOhostTransceiver objects, one for each item of cfgs, with up to numberofworkers threads which
+                call eo_hosttransceiver_New() in parallel. The boards must be all different. On linux with a heap based 
+                memory pool the construction is parallel, otherwise it is done by the calling thread.
+    @param      cfgs            array of number configurations. the nvsetbrdcfg of each one cannot be NULL.
+    @param      number          the number of objects to create.
+    @param      numberofworkers the maximum number of threads. if 0, it is used one per core.
+    @param      transceivers    array of number pointers which receives the objects.
+    @return     eores_OK if every object is created, eores_NOK_generic if the configurations are not valid or if any object
+                cannot be created. In such a case nothing is created and, if the construction was started, every item of 
+                transceivers is NULL.
+ **/
+extern eOresult_t eo_hosttransceiver_NewBatch(const eOhosttransceiver_cfg_t *cfgs, uint16_t number, uint16_t numberofworkers, EOhostTransceiver **transceivers);
+
+
 extern EOtransceiver * eo_hosttransceiver_GetTransceiver(EOhostTransceiver *p);
 
 extern EOnvSet * eo_hosttransceiver_GetNVset(EOhostTransceiver *p);
@@ -118,6 +165,20 @@ extern eOnvBRD_t eo_hosttransceiver_GetBoardNumber(EOhostTransceiver *p);
 extern eOipv4addr_t eo_hosttransceiver_GetRemoteIP(EOhostTransceiver* p);
 
 
+// it forms the name of the segment used for endpoint ep of board brd: /<sharedmemoryname>.<brd>.<ep>
+extern eOresult_t eo_hosttransceiver_shm_Name_Get(const char* sharedmemoryname, eOnvBRD_t brd, eOnvEP8_t ep, char* name, uint16_t size);
+
+// they are used by the readers to map in read-only mode a segment created by a EOhostTransceiver. _Map() returns NULL if the
+// segment does not exist or is not ready.
+extern const eOhosttransceiver_shm_header_t* eo_hosttransceiver_shm_Map(const char* name);
+
+extern void eo_hosttransceiver_shm_Unmap(const eOhosttransceiver_shm_header_t* shm);
+
+// it copies a consistent snapshot of an entity into dest, which must hold at least shm->sizeofentity[entity] bytes.
+// it returns eores_NOK_busy if it could not get a consistent copy after some retries.
+extern eOresult_t eo_hosttransceiver_shm_Entity_Read(const eOhosttransceiver_shm_header_t* shm, eOprotEntity_t entity, eOprotIndex_t index, void* dest, uint16_t size);
+
+
 
 /** @}            
     end of group eo_ecvrevrebvtr2342r7  
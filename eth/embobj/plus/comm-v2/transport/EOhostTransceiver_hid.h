@@ -62,6 +62,9 @@ struct EOhostTransceiver_hid
     EOnvSet*                nvset;
     eOnvBRD_t               boardnumber;
     eOipv4addr_t            ipaddressofboard;
+    char                    shmname[eo_hosttransceiver_shm_namesize];   // empty if the ram of the endpoints is in the heap
+    void*                   shmsegment[eoprot_endpoints_numberof];
+    uint32_t                shmsizeofsegment[eoprot_endpoints_numberof];
 }; 
 
 
@@ -66,6 +66,12 @@
     #define eov_mutex_Release(a)
 #endif
 
+#if defined(EO_ATOMIC_AVAILABLE)
+    #define EONV_SEQLOCK_BARRIER()  EO_atomic_barrier()
+#else
+    #define EONV_SEQLOCK_BARRIER()
+#endif
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables, but better using _get(), _set() 
 // --------------------------------------------------------------------------------------------------------------------
@@ -85,6 +91,7 @@
 static eOresult_t s_eo_nv_SetROP(const EOnv *nv, const void *dat, void *dst, eOnvUpdate_t upd, const eOropdescriptor_t *ropdes);
 static eOresult_t s_eo_nv_Set(const EOnv *nv, const void *dat, void *dst, eOnvUpdate_t upd);
 static void s_eo_nv_UpdateROP(const EOnv *nv, eOnvUpdate_t upd, const eOropdescriptor_t *ropdes);
+static eOresult_t s_eo_nv_seqlock_read(const EOnv *nv, void *dest, uint16_t size);
 
 
 EO_static_inline uint16_t s_eo_nv_get_size2(const EOnv *nv)
@@ -92,6 +99,36 @@ EO_static_inline uint16_t s_eo_nv_get_size2(const EOnv *nv)
     return(nv->rom->capacity);   
 }
 
+EO_static_inline void s_eo_nv_seqlock_writebegin(const EOnv *nv)
+{
+    if(NULL != nv->seqlock)
+    {
+#if defined(EO_ATOMIC_AVAILABLE)
+        // the counter moves to odd only for one writer at a time, thus the writers are serialised even without a mutex
+        for(;;)
+        {
+            uint32_t seq = *nv->seqlock;
+            if((0 == (seq & 1)) && EO_atomic_cas32(nv->seqlock, seq, seq+1))
+            {
+                break;
+            }
+        }
+#else
+        (*nv->seqlock)++;
+#endif
+        EONV_SEQLOCK_BARRIER();
+    }
+}
+
+EO_static_inline void s_eo_nv_seqlock_writeend(const EOnv *nv)
+{
+    if(NULL != nv->seqlock)
+    {
+        EONV_SEQLOCK_BARRIER();
+        (*nv->seqlock)++;
+    }
+}
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -123,7 +160,7 @@ extern void eo_nv_Delete(EOnv *nv)
         return;    
     }   
     
-    eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_vector_Delete(): needs eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (eobool_true == eo_mempool_IsDeleteSupported(eo_mempool_GetHandle())), "eo_vector_Delete(): needs eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
   
     // at first clear.
     eo_nv_Clear(nv);
@@ -147,6 +184,8 @@ extern eOresult_t eo_nv_Clear(EOnv *nv)
     nv->rom         = NULL;       
     nv->ram         = NULL;  
     nv->mtx         = NULL;
+    nv->dirty       = NULL;
+    nv->seqlock     = NULL;
       
     return(eores_OK);
 }
@@ -229,10 +268,17 @@ extern eOresult_t eo_nv_Get(const EOnv *nv, eOnvStorage_t strg, void *data, uint
         {   // better to protect so that the copy is atomic and not interrupted by other tasks which write 
             source = nv->ram;       
             *size = s_eo_nv_get_size2(nv);  
-            eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
-            memcpy(data, source, *size); 
-            eov_mutex_Release(nv->mtx);
-            res = eores_OK;
+            if(NULL != nv->seqlock)
+            {
+                res = s_eo_nv_seqlock_read(nv, data, *size);
+            }
+            else
+            {
+                eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+                memcpy(data, source, *size); 
+                eov_mutex_Release(nv->mtx);
+                res = eores_OK;
+            }
         } break;
 
         case eo_nv_strg_default:
@@ -353,17 +399,67 @@ extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eOboo
     nv->rom         = rom;
     nv->ram         = ram; 
     nv->mtx         = mtx;
+    nv->dirty       = NULL;
+    nv->seqlock     = NULL;
            
     return(eores_OK);
 }
 
+extern void eo_nv_hid_LoadDirtyFlag(EOnv *nv, uint8_t* dirty)
+{
+    nv->dirty       = dirty;
+}
+
+extern void eo_nv_hid_LoadSeqLock(EOnv *nv, volatile uint32_t* seqlock)
+{
+    nv->seqlock     = seqlock;
+}
+
 extern void eo_nv_hid_Fast_LocalMemoryGet(EOnv *nv, void* dest)
 {
+    if(NULL != nv->seqlock)
+    {
+        s_eo_nv_seqlock_read(nv, dest, nv->rom->capacity);
+        return;
+    }
+    
     eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
     memcpy(dest, nv->ram, nv->rom->capacity);
     eov_mutex_Release(nv->mtx);    
 }
 
+extern eObool_t eo_nv_hid_Fast_LocalMemoryGetIfDirty(EOnv *nv, void* dest)
+{
+    if((NULL != nv->dirty) && (0 == *(nv->dirty)))
+    {   // not written since last copy
+        return(eobool_false);
+    }
+    
+    if(NULL != nv->seqlock)
+    {
+        if(NULL != nv->dirty)
+        {
+            *(nv->dirty) = 0;
+        }
+        if((eores_OK != s_eo_nv_seqlock_read(nv, dest, nv->rom->capacity)) && (NULL != nv->dirty))
+        {   // dest may be inconsistent: we copy it again next time
+            *(nv->dirty) = 1;
+        }
+        return(eobool_true);
+    }
+    
+    eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+    // we clear the flag before the copy, so that a write which happens after the copy marks it again.
+    if(NULL != nv->dirty)
+    {
+        *(nv->dirty) = 0;
+    }
+    memcpy(dest, nv->ram, nv->rom->capacity);
+    eov_mutex_Release(nv->mtx); 
+    
+    return(eobool_true);
+}
+
 
 extern eObool_t eo_nv_hid_isWritable(const EOnv *nv)
 {   
@@ -489,7 +585,13 @@ static eOresult_t s_eo_nv_SetROP(const EOnv *nv, const void *dat, void *dst, eOn
 
     // copy data
     eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+    s_eo_nv_seqlock_writebegin(nv);
     memcpy(dst, dat, size);
+    s_eo_nv_seqlock_writeend(nv);
+    if(NULL != nv->dirty)
+    {
+        *(nv->dirty) = 1;
+    }
     eov_mutex_Release(nv->mtx);
 
     // call the update function if necessary
@@ -498,6 +600,34 @@ static eOresult_t s_eo_nv_SetROP(const EOnv *nv, const void *dat, void *dst, eOn
     return(eores_OK);
 }
 
+static eOresult_t s_eo_nv_seqlock_read(const EOnv *nv, void *dest, uint16_t size)
+{
+    // optimistic copy: we retry until no write has started or ended during the copy. the retries are bounded, so that a
+    // reader cannot spin forever on a writer which has been preempted inside the write (as on a single core)
+    enum { maxretries = 1000 };
+    uint16_t retries = 0;
+    
+    for(retries=0; retries<maxretries; retries++)
+    {
+        uint32_t seq = *nv->seqlock;
+        if(0 != (seq & 1))
+        {   // a writer is inside
+            continue;
+        }
+        EONV_SEQLOCK_BARRIER();
+        memcpy(dest, nv->ram, size);
+        EONV_SEQLOCK_BARRIER();
+        if(seq == *nv->seqlock)
+        {
+            return(eores_OK);
+        }
+    }
+    
+    eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "s_eo_nv_seqlock_read(): too many retries", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+    
+    return(eores_NOK_busy);
+}
+
 static void s_eo_nv_UpdateROP(const EOnv *nv, eOnvUpdate_t upd, const eOropdescriptor_t *ropdes)
 {
     // call the update function if necessary
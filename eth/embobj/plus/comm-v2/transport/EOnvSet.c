@@ -54,6 +54,18 @@
 
 #undef EO_NVSET_INIT_EVERY_NV
 
+#if defined(EO_ATOMIC_AVAILABLE)
+    #define EONVSET_LAZYINIT_BARRIER()  EO_atomic_barrier()
+#else
+    #define EONVSET_LAZYINIT_BARRIER()
+#endif
+
+// who finds an entity whose lazy init is in progress waits for its end, unless it is the thread doing the init which accesses 
+// the entity again from inside the init. we need the thread local variables to tell so.
+#if defined(EO_ATOMIC_AVAILABLE) && defined(EO_THREAD_LOCAL_AVAILABLE)
+    #define EONVSET_LAZYINIT_WAIT
+#endif
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables, but better using _get(), _set() 
 // --------------------------------------------------------------------------------------------------------------------
@@ -65,7 +77,10 @@ static const EOconstvector s_eonvset_constvectofEPcfgBasic =
     EO_INIT(.item_size)       sizeof(eOprot_EPcfg_t),
     EO_INIT(.dummy)           0,  
     EO_INIT(.stored_items)    (void*) &eoprot_mn_basicEPcfg,
-    EO_INIT(.functions)       NULL     
+    EO_INIT(.functions)       NULL,
+    EO_INIT(.first)           0,
+    EO_INIT(.ring)            eobool_false,
+    EO_INIT(.filler)          0
 };
 
 const eOnvset_BRDcfg_t eonvset_BRDcfgBasic =
@@ -82,7 +97,10 @@ static const EOconstvector s_eonvset_constvectofEPcfgMax =
     EO_INIT(.item_size)       sizeof(eOprot_EPcfg_t),
     EO_INIT(.dummy)           0,  
     EO_INIT(.stored_items)    (void*) eoprot_arrayof_maxEPcfg,
-    EO_INIT(.functions)       NULL          
+    EO_INIT(.functions)       NULL,
+    EO_INIT(.first)           0,
+    EO_INIT(.ring)            eobool_false,
+    EO_INIT(.filler)          0
 };
 
 const eOnvset_BRDcfg_t eonvset_BRDcfgMax =
@@ -100,7 +118,10 @@ static const EOconstvector s_eonvset_constvectofEPcfgStd =
     EO_INIT(.item_size)       sizeof(eOprot_EPcfg_t),
     EO_INIT(.dummy)           0,  
     EO_INIT(.stored_items)    (void*) eoprot_arrayof_stdEPcfg,
-    EO_INIT(.functions)       NULL          
+    EO_INIT(.functions)       NULL,
+    EO_INIT(.first)           0,
+    EO_INIT(.ring)            eobool_false,
+    EO_INIT(.filler)          0
 };
 
 const eOnvset_BRDcfg_t eonvset_BRDcfgStd =
@@ -114,6 +135,17 @@ const eOnvset_BRDcfg_t eonvset_BRDcfgStd =
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
 
+// the states of a slot of eOnvset_ep_t::entitiesinitted
+enum { eo_nvset_lazyinit_inprogress = 1, eo_nvset_lazyinit_done = 2 };
+
+// the lazy inits in progress in the running thread, from the innermost one
+typedef struct eOnvset_lazyinit_frame_t
+{
+    const eOnvset_ep_t*                 endpoint;
+    uint16_t                            slot;
+    struct eOnvset_lazyinit_frame_t*    prev;
+} eOnvset_lazyinit_frame_t;
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -128,7 +160,19 @@ static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p);
 static eOresult_t s_eo_nvset_DeinitDEV(EOnvSet* p);
 
 static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32);
+static EOVmutexDerived* s_eo_nvset_get_stripemutex(eOnvset_brd_t* theBoard, eOnvID32_t id32);
 static eOnvset_ep_t* s_eo_nvset_get_endpoint(EOnvSet* p, eOnvEP8_t ep8);
+static uint8_t* s_eo_nvset_get_dirtyflag(EOnvSet* p, eOnvID32_t id32);
+static void s_eo_nvset_dirtyflags_create(eOnvset_ep_t* theEndpoint);
+static void s_eo_nvset_resolved_create(EOnvSet* p, eOnvset_ep_t* theEndpoint);
+static eOnvset_ep_t* s_eo_nvset_resolve(EOnvSet* p, eOnvID32_t id32, uint16_t* prognum);
+static void s_eo_nvset_proxied_evaluate(EOnvSet* p, eOnvset_ep_t* theEndpoint);
+static void s_eo_nvset_lazyinit_prepare(EOnvSet* p, eOnvset_ep_t* theEndpoint);
+static eObool_t s_eo_nvset_lazyinit_begin(eOnvset_ep_t* theEndpoint, uint16_t slot, eOnvset_lazyinit_frame_t* frame);
+static void s_eo_nvset_lazyinit_end(eOnvset_ep_t* theEndpoint, uint16_t slot, eOnvset_lazyinit_frame_t* frame);
+static void s_eo_nvset_lazyinit_entity(EOnvSet* p, eOnvset_ep_t* theEndpoint, eOnvENT_t ent, uint8_t index);
+static void s_eo_nvset_lazyinit_all(EOnvSet* p, eOnvset_ep_t* theEndpoint);
+static void s_eo_nvset_onentityaccess(void* arg, eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotIndex_t index);
 uint16_t s_eonvset_EP2INDEX(EOnvSet* p, uint8_t ep08);
 
 
@@ -138,6 +182,10 @@ uint16_t s_eonvset_EP2INDEX(EOnvSet* p, uint8_t ep08);
 
 //static const char s_eobj_ownname[] = "EOnvSet";
 
+#if defined(EONVSET_LAZYINIT_WAIT)
+static EO_thread_local eOnvset_lazyinit_frame_t* s_eo_nvset_lazyinit_frames = NULL;
+#endif
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern public functions
@@ -148,13 +196,24 @@ extern EOnvSet* eo_nvset_New(eOnvset_protection_t prot, eov_mutex_fn_mutexderive
 {
     EOnvSet *p = NULL;  
 
+#if !defined(EO_ATOMIC_AVAILABLE)
+    if(eo_nvset_protection_seqlock == prot)
+    {   // the writers would increment the counters without atomic operations and the readers would not have any barrier
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_nvset_New(): seqlock needs atomics on this platform", NULL, &eo_errman_DescrWrongUsageLocal);
+    }
+#endif
+
     // i get the memory for the object
     p = (EOnvSet*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(EOnvSet), 1);
     
     // i dont initialise yet the device. i simply rely on the fact that it contains all zero data.
     p->theboard.ipaddress       = 0;    
     p->mtxderived_new           = mtxnew; 
-    p->protection               = (NULL == mtxnew) ? (eo_nvset_protection_none) : (prot); 
+    p->protection               = ((NULL == mtxnew) && (eo_nvset_protection_seqlock != prot)) ? (eo_nvset_protection_none) : (prot); 
+    p->dirtytracking            = eobool_false;
+    memset(&p->epramprovider, 0, sizeof(eOnvset_EPramprovider_t));
+    p->numberofstripes          = eo_nvset_stripes_default;
+    p->lazyinit                 = eobool_false;
 
     return(p);
 }
@@ -328,6 +387,12 @@ static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoi
     }    
        
 
+    if(NULL != theEndpoint->entitiesinitted)
+    {   // lazy mode: we initialise the entities not initialised yet
+        s_eo_nvset_lazyinit_all(p, theEndpoint);
+        return(eores_OK);
+    }
+
     if(eobool_true == (theEndpoint->initted))
     {   // already initted
         return(eores_OK);
@@ -386,6 +451,11 @@ static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoi
             {
                 continue;
             }
+            
+            if(eo_nvset_protection_striped == p->protection)
+            {
+                mtx2use = s_eo_nvset_get_stripemutex(theBoard, id32);
+            }
 
             // - 0+. proxied?
             proxied = eoprot_variable_is_proxied(brd, id32);                
@@ -454,11 +524,20 @@ extern eOresult_t eo_nvset_NVSinitialise(EOnvSet* p)
 
 extern void* eo_nvset_RAMofEndpoint_Get(EOnvSet* p, eOnvEP8_t ep8)
 { 
+    eOnvset_ep_t* theEndpoint = NULL;
+    
     if((NULL == p)) 
     {
         return(NULL); 
     }
     
+    // the caller may access every entity
+    theEndpoint = s_eo_nvset_get_endpoint(p, ep8);
+    if((NULL != theEndpoint) && (NULL != theEndpoint->entitiesinitted))
+    {
+        s_eo_nvset_lazyinit_all(p, theEndpoint);
+    }
+    
     // get directly the ram using the eoprot function.     
     return(eoprot_endpoint_ramof_get(p->theboard.boardnum, ep8));   
 }
@@ -478,12 +557,26 @@ extern void* eo_nvset_RAMofEntity_Get(EOnvSet* p, eOnvEP8_t ep8, eOnvENT_t ent,
 
 extern void* eo_nvset_RAMofVariable_Get(EOnvSet* p, eOnvID32_t id32)
 { 
+    eOnvset_ep_t* theEndpoint = NULL;
+    uint16_t prognum = 0;
+    
     if((NULL == p)) 
     {
         return(NULL); 
     }
+    
+    theEndpoint = s_eo_nvset_resolve(p, id32, &prognum);
+    if(NULL == theEndpoint)
+    {
+        return(NULL);
+    }
+    
+    if(NULL != theEndpoint->entitiesinitted)
+    {
+        s_eo_nvset_lazyinit_entity(p, theEndpoint, eoprot_ID2entity(id32), eoprot_ID2index(id32));
+    }
 
-    return(eoprot_variable_ramof_get(p->theboard.boardnum, id32));
+    return(theEndpoint->nvsresolved[prognum].ram);
 }
 
 
@@ -505,10 +598,10 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
     eOnvEP8_t ep8 = eoprot_ID2endpoint(id32); 
     uint8_t brd = 0; // local, or 0, 1, 2, 3 ...
     eObool_t proxied = eobool_false;
-    EOnv_rom_t* rom = NULL;
-    uint8_t* ram = NULL;
-    EOVmutexDerived* mtx2use = NULL;
     eOvoid_fp_cnvp_cropdesp_t onsay = NULL;
+    eOnvset_ep_t* theEndpoint = NULL;
+    eOnvset_nvresolved_t* resolved = NULL;
+    uint16_t prognum = 0;
  
     if((NULL == p) || (NULL == thenv)) 
     {
@@ -517,32 +610,38 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
 
     brd = p->theboard.boardnum;
     
-    // - verify that on the given endpoint there is a valid id32. if the id32 is not recognised, then ... eores_NOK_generic
-    if(eobool_false == eoprot_id_isvalid(brd, id32))
+    // - verify that on the given endpoint there is a valid id32 and get its prognum. if the id32 is not recognised, then ... eores_NOK_generic
+    theEndpoint = s_eo_nvset_resolve(p, id32, &prognum);
+    if(NULL == theEndpoint)
     {
         return(eores_NOK_generic);       
     }
     
-    // - retrieve from the device and endpoint what is required to form the netvar: con, ram, mtx, etc.   
-    // - 0+. proxied? 
-    proxied = eoprot_variable_is_proxied(brd, id32);
-    // - 0++. the onsay function
-    onsay = eoprot_onsay_endpoint_get(ep8);   
-    // - 1. the rom
-    rom = (EOnv_rom_t*) eoprot_variable_romof_get(brd, id32);
-    // - 2. the ram
-    ram = (uint8_t*) eoprot_variable_ramof_get(brd, id32);
-    // - 3. the mtx
-    mtx2use = s_eo_nvset_get_nvmutex(p, id32);
-        
-    // - final control about the validity of id32. it may be redundant but it is safer. for instance if the fptr_isepidsupported()
-    //   does not take into account a removed tag and just checks that the tag-number is lower than the max allowed.
+    // - rom, ram and mtx were resolved in eo_nvset_LoadEP(). 
+    resolved = &theEndpoint->nvsresolved[prognum];
     
-    if((NULL == rom) || (NULL == ram))  // mtx2use can be NULL
+    // - final control about the validity of id32. it may be redundant but it is safer. for instance if the fptr_isepidsupported()
+    //   does not take into account a removed tag and just checks that the tag-number is lower than the max allowed.    
+    if((NULL == resolved->rom) || (NULL == resolved->ram))  // mtx can be NULL
     {
         return(eores_NOK_generic); 
     }
     
+    // - 0. in lazy mode, the entity is initialised at its first access
+    if(NULL != theEndpoint->entitiesinitted)
+    {
+        s_eo_nvset_lazyinit_entity(p, theEndpoint, eoprot_ID2entity(id32), eoprot_ID2index(id32));
+    }
+    
+    // - 0+. proxied? we evaluate eoprot_variable_is_proxied() for all the endpoint only if its configuration has changed
+    if((eobool_false == theEndpoint->nvsproxiedvalid) || (theEndpoint->nvsproxiedchanges != eoprot_config_proxied_variables_changes_get(brd)))
+    {
+        s_eo_nvset_proxied_evaluate(p, theEndpoint);
+    }
+    proxied = (0 != (theEndpoint->nvsproxied[prognum >> 5] & (1u << (prognum & 31)))) ? (eobool_true) : (eobool_false);
+    // - 0++. the onsay function can be changed in runtime, thus we ask it every time
+    onsay = eoprot_onsay_endpoint_get(ep8);   
+    
 
     // - load everything into the nv
     eo_nv_hid_Load(     thenv,
@@ -551,15 +650,158 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
                         proxied,
                         id32,  
                         onsay,
-                        rom,
-                        ram,
-                        mtx2use
+                        resolved->rom,
+                        resolved->ram,
+                        resolved->mtx
                   );    
+    
+    if(eobool_true == p->dirtytracking)
+    {
+        eo_nv_hid_LoadDirtyFlag(thenv, (NULL == theEndpoint->nvsdirtyflags) ? (NULL) : (&theEndpoint->nvsdirtyflags[prognum]));
+    }
+    
+    if(NULL != theEndpoint->entityseqlocks)
+    {
+        eo_nv_hid_LoadSeqLock(thenv, &theEndpoint->entityseqlocks[theEndpoint->entityfirstinstance[eoprot_ID2entity(id32)] + eoprot_ID2index(id32)]);
+    }
 
     return(eores_OK);
 }
 
 
+extern eOresult_t eo_nvset_DirtyTracking_Enable(EOnvSet* p)
+{
+    uint16_t i = 0;
+    uint16_t nendpoints = 0;
+    
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer); 
+    }
+    
+    if(eobool_true == p->dirtytracking)
+    {
+        return(eores_OK);
+    }
+    
+    p->dirtytracking = eobool_true;
+    
+    // the endpoints already loaded get their flags now, the others in eo_nvset_LoadEP()
+    nendpoints = (NULL == p->theboard.theendpoints) ? (0) : (eo_vector_Size(p->theboard.theendpoints));
+    for(i=0; i<nendpoints; i++)
+    {
+        eOnvset_ep_t** theEndpoint = (eOnvset_ep_t**) eo_vector_At(p->theboard.theendpoints, i);
+        s_eo_nvset_dirtyflags_create(*theEndpoint);
+    }
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_nvset_LazyInit_Enable(EOnvSet* p)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer); 
+    }
+    
+    p->lazyinit = eobool_true;
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_nvset_ProtectionStripes_Set(EOnvSet* p, uint16_t numberofstripes)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer); 
+    }
+    
+    if((NULL != p->theboard.theendpoints) || (0 == numberofstripes) || (numberofstripes > eo_nvset_stripes_max))
+    {   // already initted or wrong value
+        return(eores_NOK_generic);
+    }
+    
+    p->numberofstripes = numberofstripes;
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_nvset_EPramProvider_Set(EOnvSet* p, const eOnvset_EPramprovider_t* provider)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer); 
+    }
+    
+    if((NULL != p->theboard.theendpoints) && (0 != eo_vector_Size(p->theboard.theendpoints)))
+    {   // the ram of the loaded endpoints would be released with the wrong provider
+        return(eores_NOK_generic);
+    }
+    
+    if(NULL == provider)
+    {
+        memset(&p->epramprovider, 0, sizeof(eOnvset_EPramprovider_t));
+    }
+    else
+    {
+        memcpy(&p->epramprovider, provider, sizeof(eOnvset_EPramprovider_t));
+    }
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_nvset_ProxiedVariables_Invalidate(EOnvSet* p)
+{
+    uint16_t i = 0;
+    uint16_t nendpoints = 0;
+    
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer); 
+    }
+    
+    // the endpoints evaluate again at their next eo_nvset_NV_Get()
+    nendpoints = (NULL == p->theboard.theendpoints) ? (0) : (eo_vector_Size(p->theboard.theendpoints));
+    for(i=0; i<nendpoints; i++)
+    {
+        eOnvset_ep_t** theEndpoint = (eOnvset_ep_t**) eo_vector_At(p->theboard.theendpoints, i);
+        (*theEndpoint)->nvsproxiedvalid = eobool_false;
+    }
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_nvset_NV_MarkDirty(EOnvSet* p, eOnvID32_t id32)
+{
+    uint8_t* dirty = NULL;
+    
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer); 
+    }
+    
+    if(eobool_false == p->dirtytracking)
+    {   // nothing to do
+        return(eores_OK);
+    }
+    
+    dirty = s_eo_nvset_get_dirtyflag(p, id32);
+    if(NULL == dirty)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    *dirty = 1;
+    
+    return(eores_OK);
+}
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
@@ -592,6 +834,18 @@ static eOresult_t s_eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, e
     theBoard->ownership             = ownership;
     theBoard->theendpoints          = eo_vector_New(sizeof(eOnvset_ep_t*), eo_vectorcapacity_dynamic, NULL, 0, NULL, NULL);    
     theBoard->mtx_board             = (eo_nvset_protection_one_per_board == p->protection) ? p->mtxderived_new() : NULL;
+    theBoard->mtx_stripes           = NULL;
+    theBoard->numberofstripes       = 0;
+    if(eo_nvset_protection_striped == p->protection)
+    {
+        uint16_t i = 0;
+        theBoard->numberofstripes   = p->numberofstripes;
+        theBoard->mtx_stripes       = (EOVmutexDerived**) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(EOVmutexDerived*), theBoard->numberofstripes);
+        for(i=0; i<theBoard->numberofstripes; i++)
+        {
+            theBoard->mtx_stripes[i] = p->mtxderived_new();
+        }
+    }
     // reset the ep2indexlut to have all values EOK_uint16dummy
     {
         uint8_t i = 0;
@@ -612,6 +866,7 @@ static eOresult_t s_eo_nvset_DeinitDEV(EOnvSet* p)
     
     // the array of endpoints
     eo_vector_Delete(theBoard->theendpoints);
+    theBoard->theendpoints = NULL;
     
     // the mtx of device, if non NULL
     if(NULL != theBoard->mtx_board)
@@ -619,6 +874,19 @@ static eOresult_t s_eo_nvset_DeinitDEV(EOnvSet* p)
         eov_mutex_Delete(theBoard->mtx_board);
     }
     
+    // the striped mutexes, if any
+    if(NULL != theBoard->mtx_stripes)
+    {
+        uint16_t i = 0;
+        for(i=0; i<theBoard->numberofstripes; i++)
+        {
+            eov_mutex_Delete(theBoard->mtx_stripes[i]);
+        }
+        eo_mempool_Delete(eo_mempool_GetHandle(), theBoard->mtx_stripes);
+        theBoard->mtx_stripes = NULL;
+        theBoard->numberofstripes = 0;
+    }
+    
     
     // so that we know that everything is deinitted
     p->theboard.ipaddress = 0;
@@ -671,8 +939,48 @@ extern eOresult_t eo_nvset_LoadEP(EOnvSet* p, eOprot_EPcfg_t *cfgofep, eObool_t
     
     theEndpoint->epnvsnumberof      = epnvsnumberof;
     theEndpoint->initted            = eobool_false;    
-    theEndpoint->epram              = (void*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeofram, 1);
+    theEndpoint->epram              = NULL;
+    theEndpoint->epramprovided      = eobool_false;
+    theEndpoint->entityseqlocks     = NULL;
+    theEndpoint->entityseqlocksowned = eobool_false;
+    if(NULL != p->epramprovider.get)
+    {
+        theEndpoint->epram = p->epramprovider.get(p->epramprovider.arg, brd, theEndpoint->epcfg.endpoint, sizeofram, &theEndpoint->entityseqlocks);
+        theEndpoint->epramprovided = (NULL == theEndpoint->epram) ? (eobool_false) : (eobool_true);
+    }
+    if(NULL == theEndpoint->epram)
+    {
+        theEndpoint->epram = (void*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeofram, 1);
+        theEndpoint->entityseqlocks = NULL;
+    }
+    {
+        uint16_t ent = 0;
+        uint16_t first = 0;
+        for(ent=0; ent<eoprot_entities_maxnumberofsupported; ent++)
+        {
+            theEndpoint->entityfirstinstance[ent] = first;
+            first += theEndpoint->epcfg.numberofentities[ent];
+        }
+        theEndpoint->entitiesnumberof = first;
+    }
+    if((NULL == theEndpoint->entityseqlocks) && (eo_nvset_protection_seqlock == p->protection))
+    {
+        theEndpoint->entityseqlocks = (volatile uint32_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(uint32_t), theEndpoint->entitiesnumberof);
+        memset((void*)theEndpoint->entityseqlocks, 0, theEndpoint->entitiesnumberof*sizeof(uint32_t));
+        theEndpoint->entityseqlocksowned = eobool_true;
+    }
+    theEndpoint->entitiesinitted    = NULL;
+    theEndpoint->entitiestoinit     = 0;
     theEndpoint->mtx_endpoint       = (eo_nvset_protection_one_per_endpoint == p->protection) ? p->mtxderived_new() : NULL;
+    theEndpoint->nvsdirtyflags      = NULL;
+    theEndpoint->nvsresolved        = NULL;
+    theEndpoint->nvsproxied         = NULL;
+    theEndpoint->nvsproxiedchanges  = 0;
+    theEndpoint->nvsproxiedvalid    = eobool_false;
+    if(eobool_true == p->dirtytracking)
+    {
+        s_eo_nvset_dirtyflags_create(theEndpoint);
+    }
         
     // now we must load the ram in the endpoint
     eoprot_config_endpoint_ram(brd, theEndpoint->epcfg.endpoint, theEndpoint->epram, sizeofram);
@@ -694,8 +1002,15 @@ extern eOresult_t eo_nvset_LoadEP(EOnvSet* p, eOprot_EPcfg_t *cfgofep, eObool_t
     // and only now i push back the endpoint
     eo_vector_PushBack(theBoard->theendpoints, &theEndpoint);
     
+    // the endpoint is now fully configured: we can resolve its nvs (the mtx of the endpoint is found only after the push back)
+    s_eo_nvset_resolved_create(p, theEndpoint);
+    
     
-    if(eobool_true == initNVs)
+    if((eobool_true == initNVs) && (eobool_true == p->lazyinit))
+    {   // the entities are initialised at their first access
+        s_eo_nvset_lazyinit_prepare(p, theEndpoint);
+    }
+    else if(eobool_true == initNVs)
     {
         s_eo_nvset_NVsOfEP_Initialise(p, theEndpoint, theEndpoint->epcfg.endpoint); 
     }
@@ -724,7 +1039,17 @@ static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p)
         eOnvset_ep_t *theEndpoint = *ppep;
         
         // now i erase memory associated with this endpoint
-        eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->epram);
+        if(eobool_true == theEndpoint->epramprovided)
+        {
+            if(NULL != p->epramprovider.release)
+            {
+                p->epramprovider.release(p->epramprovider.arg, theBoard->boardnum, theEndpoint->epcfg.endpoint, theEndpoint->epram);
+            }
+        }
+        else
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->epram);
+        }
         // and i dissociates that from from the internals of the eoprot library
         eoprot_config_endpoint_ram(theBoard->boardnum, theEndpoint->epcfg.endpoint, NULL, 0);
         // i also de-init the number of entities for that endpoint
@@ -747,13 +1072,38 @@ static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p)
             } 
             eo_vector_Delete(theEndpoint->themtxofthenvs);
         }
+        
+        if(NULL != theEndpoint->nvsdirtyflags)
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->nvsdirtyflags);
+        }
+        
+        if(NULL != theEndpoint->nvsresolved)
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->nvsresolved);
+        }
+        
+        if(NULL != theEndpoint->nvsproxied)
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->nvsproxied);
+        }
+        
+        if(eobool_true == theEndpoint->entityseqlocksowned)
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), (void*)theEndpoint->entityseqlocks);
+        }
+        
+        if(NULL != theEndpoint->entitiesinitted)
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), (void*)theEndpoint->entitiesinitted);
+        }
    
         // now i erase the memory of the entire eOnvset_ep_t entry        
         eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint);       
     }
     
-    // so that we dont get in here inside again
-    theBoard->theendpoints = NULL;
+    // so that we dont get in here inside again. the vector is deleted by s_eo_nvset_DeinitDEV()
+    eo_vector_Clear(theBoard->theendpoints);
 
     return(eores_OK);
 }
@@ -798,6 +1148,11 @@ static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32)
                 }
             } break;  
             
+            case eo_nvset_protection_striped:
+            {
+                mtx2use = s_eo_nvset_get_stripemutex(&p->theboard, id32);
+            } break;
+            
             default:
             {
                 mtx2use = NULL;
@@ -810,6 +1165,20 @@ static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32)
 }
 
 
+static EOVmutexDerived* s_eo_nvset_get_stripemutex(eOnvset_brd_t* theBoard, eOnvID32_t id32)
+{
+    // multiplicative hash, so that the nvs of the same entity (which differ only in the low bits) spread over the stripes
+    uint32_t hash = id32 * 2654435761u;
+    
+    if(NULL == theBoard->mtx_stripes)
+    {
+        return(NULL);
+    }
+    
+    return(theBoard->mtx_stripes[(hash >> 16) % theBoard->numberofstripes]);
+}
+
+
 static eOnvset_ep_t* s_eo_nvset_get_endpoint(EOnvSet* p, eOnvEP8_t ep8)
 {
     eOnvset_brd_t* theBoard = &p->theboard;
@@ -831,6 +1200,355 @@ static eOnvset_ep_t* s_eo_nvset_get_endpoint(EOnvSet* p, eOnvEP8_t ep8)
 }
 
 
+static uint8_t* s_eo_nvset_get_dirtyflag(EOnvSet* p, eOnvID32_t id32)
+{
+    uint16_t nvprognumber = 0;
+    eOnvset_ep_t* theEndpoint = s_eo_nvset_resolve(p, id32, &nvprognumber);
+    
+    if((NULL == theEndpoint) || (NULL == theEndpoint->nvsdirtyflags))
+    {
+        return(NULL);
+    }
+    
+    return(&theEndpoint->nvsdirtyflags[nvprognumber]);
+}
+
+
+static void s_eo_nvset_dirtyflags_create(eOnvset_ep_t* theEndpoint)
+{
+    // we use a byte per nv rather than a bit, so that concurrent writers of different nvs never race on the same word.
+    // all flags start at 1 so that the first copy of every nv is done.
+    if(NULL == theEndpoint->nvsdirtyflags)
+    {
+        theEndpoint->nvsdirtyflags = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_08bit, sizeof(uint8_t), theEndpoint->epnvsnumberof);
+    }
+    memset(theEndpoint->nvsdirtyflags, 1, theEndpoint->epnvsnumberof);
+}
+
+
+static void s_eo_nvset_resolved_create(EOnvSet* p, eOnvset_ep_t* theEndpoint)
+{
+    // we walk the nvs of the endpoint once in the order of their prognum. the eoprot functions used in here loop over 
+    // the entities, thus we do that only now and we keep: for each entity the prognum of its first nv and its number 
+    // of tags, and for each nv its rom, ram and mtx. then eo_nvset_NV_Get() only needs some bound checks and an index.
+    uint8_t brd = p->theboard.boardnum;
+    eOnvEP8_t ep08 = theEndpoint->epcfg.endpoint;
+    uint16_t prog = 0;
+    
+    memset(theEndpoint->entityfirstprognum, 0, sizeof(theEndpoint->entityfirstprognum));
+    memset(theEndpoint->entitytagsnumberof, 0, sizeof(theEndpoint->entitytagsnumberof));
+    
+    theEndpoint->nvsresolved = (eOnvset_nvresolved_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(eOnvset_nvresolved_t), theEndpoint->epnvsnumberof);
+    theEndpoint->nvsproxied = (uint32_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(uint32_t), (theEndpoint->epnvsnumberof+31)/32);
+    
+    for(prog=0; prog<theEndpoint->epnvsnumberof; prog++)
+    {
+        eOnvset_nvresolved_t* item = &theEndpoint->nvsresolved[prog];
+        eOnvID32_t id32 = eoprot_endpoint_prognum2id(brd, ep08, prog);
+        eOnvENT_t ent = 0;
+        
+        if(EOK_uint32dummy == id32)
+        {
+            item->rom = NULL;
+            item->ram = NULL;
+            item->mtx = NULL;
+            continue;
+        }
+        
+        ent = eoprot_ID2entity(id32);
+        if(0 == eoprot_ID2index(id32))
+        {   // the nvs of an entity are ordered by index and then by tag
+            if(0 == eoprot_ID2tag(id32))
+            {
+                theEndpoint->entityfirstprognum[ent] = prog;
+            }
+            theEndpoint->entitytagsnumberof[ent] = eoprot_ID2tag(id32) + 1;
+        }
+        
+        item->rom = (EOnv_rom_t*) eoprot_variable_romof_get(brd, id32);
+        item->ram = eoprot_variable_ramof_get(brd, id32);
+        item->mtx = s_eo_nvset_get_nvmutex(p, id32);
+    }
+}
+
+
+static eOnvset_ep_t* s_eo_nvset_resolve(EOnvSet* p, eOnvID32_t id32, uint16_t* prognum)
+{
+    // it gives the same validation of eoprot_id_isvalid() and the same result of eoprot_endpoint_id2prognum()
+    eOnvset_ep_t* theEndpoint = s_eo_nvset_get_endpoint(p, eoprot_ID2endpoint(id32));
+    eOnvENT_t ent = eoprot_ID2entity(id32);
+    uint8_t index = eoprot_ID2index(id32);
+    uint8_t tag = eoprot_ID2tag(id32);
+    uint8_t tagsnumberof = 0;
+    
+    if((NULL == theEndpoint) || (NULL == theEndpoint->nvsresolved) || (ent >= eoprot_entities_maxnumberofsupported))
+    {
+        return(NULL);
+    }
+    
+    tagsnumberof = theEndpoint->entitytagsnumberof[ent];
+    
+    if((index >= theEndpoint->epcfg.numberofentities[ent]) || (tag >= tagsnumberof))
+    {
+        return(NULL);
+    }
+    
+    *prognum = theEndpoint->entityfirstprognum[ent] + index*tagsnumberof + tag;
+    
+    return(theEndpoint);
+}
+
+
+static void s_eo_nvset_proxied_evaluate(EOnvSet* p, eOnvset_ep_t* theEndpoint)
+{
+    // we fill a word at a time, so that a concurrent eo_nvset_NV_Get() never sees a partially written word
+    uint8_t brd = p->theboard.boardnum;
+    uint16_t nwords = (theEndpoint->epnvsnumberof+31)/32;
+    uint16_t w = 0;
+    
+    theEndpoint->nvsproxiedchanges = eoprot_config_proxied_variables_changes_get(brd);
+    
+    for(w=0; w<nwords; w++)
+    {
+        uint32_t word = 0;
+        uint16_t b = 0;
+        for(b=0; (b<32) && ((32*w+b) < theEndpoint->epnvsnumberof); b++)
+        {
+            eOnvID32_t id32 = eoprot_endpoint_prognum2id(brd, theEndpoint->epcfg.endpoint, 32*w+b);
+            if((EOK_uint32dummy != id32) && (eobool_true == eoprot_variable_is_proxied(brd, id32)))
+            {
+                word |= (1u << b);
+            }
+        }
+        theEndpoint->nvsproxied[w] = word;
+    }
+    
+    theEndpoint->nvsproxiedvalid = eobool_true;
+}
+
+
+static void s_eo_nvset_lazyinit_prepare(EOnvSet* p, eOnvset_ep_t* theEndpoint)
+{
+    // two bits per slot: eo_nvset_lazyinit_inprogress and eo_nvset_lazyinit_done. the last slot is for the initialiser of the endpoint
+    uint16_t nwords = (theEndpoint->entitiesnumberof+1+15)/16;
+    uint32_t* words = (uint32_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(uint32_t), nwords);
+    
+    memset(words, 0, nwords*sizeof(uint32_t));
+    theEndpoint->entitiesinitted = words;
+    theEndpoint->entitiestoinit = theEndpoint->entitiesnumberof;
+    
+    // so that also the accesses done directly with eoprot_entity_ramof_get() and eoprot_variable_ramof_get() initialise the entity
+    eoprot_config_endpoint_onentityaccess(p->theboard.boardnum, theEndpoint->epcfg.endpoint, s_eo_nvset_onentityaccess, p);
+}
+
+
+static eObool_t s_eo_nvset_lazyinit_begin(eOnvset_ep_t* theEndpoint, uint16_t slot, eOnvset_lazyinit_frame_t* frame)
+{
+    // it returns eobool_true only to the first caller, which must do the init and then call s_eo_nvset_lazyinit_end(). 
+    // the others return when the init is done, so that they never use the ram before or during the init. the exception
+    // is the thread doing the init, which may access the entity again from inside it.
+    volatile uint32_t* word = &theEndpoint->entitiesinitted[slot >> 4];
+    uint8_t shift = (slot & 15) << 1;
+    eObool_t claimed = eobool_false;
+#if defined(EONVSET_LAZYINIT_WAIT)
+    const eOnvset_lazyinit_frame_t* f = NULL;
+#endif
+    
+#if defined(EO_ATOMIC_AVAILABLE)
+    for(;;)
+    {
+        uint32_t value = *word;
+        if(0 != ((value >> shift) & 3))
+        {   // done or in progress
+            break;
+        }
+        if(EO_atomic_cas32(word, value, value | ((uint32_t)eo_nvset_lazyinit_inprogress << shift)))
+        {
+            claimed = eobool_true;
+            break;
+        }
+    }
+#else
+    if(0 == ((*word >> shift) & 3))
+    {
+        *word |= ((uint32_t)eo_nvset_lazyinit_inprogress << shift);
+        claimed = eobool_true;
+    }
+#endif
+    
+    if(eobool_true == claimed)
+    {
+#if defined(EONVSET_LAZYINIT_WAIT)
+        frame->endpoint = theEndpoint;
+        frame->slot = slot;
+        frame->prev = s_eo_nvset_lazyinit_frames;
+        s_eo_nvset_lazyinit_frames = frame;
+#else
+        frame = frame;
+#endif
+        return(eobool_true);
+    }
+    
+#if defined(EONVSET_LAZYINIT_WAIT)
+    for(f = s_eo_nvset_lazyinit_frames; NULL != f; f = f->prev)
+    {
+        if((f->endpoint == theEndpoint) && (f->slot == slot))
+        {   // we are inside our own init
+            return(eobool_false);
+        }
+    }
+    
+    while(0 == ((*word >> shift) & eo_nvset_lazyinit_done))
+    {
+        ;
+    }
+#endif
+    
+    EONVSET_LAZYINIT_BARRIER();
+    
+    return(eobool_false);
+}
+
+
+static void s_eo_nvset_lazyinit_end(eOnvset_ep_t* theEndpoint, uint16_t slot, eOnvset_lazyinit_frame_t* frame)
+{
+    volatile uint32_t* word = &theEndpoint->entitiesinitted[slot >> 4];
+    uint32_t bits = (uint32_t)eo_nvset_lazyinit_done << ((slot & 15) << 1);
+    
+    // the ram must be written before anyone sees the slot as done
+    EONVSET_LAZYINIT_BARRIER();
+    
+#if defined(EO_ATOMIC_AVAILABLE)
+    for(;;)
+    {
+        uint32_t value = *word;
+        if(EO_atomic_cas32(word, value, value | bits))
+        {
+            break;
+        }
+    }
+#else
+    *word |= bits;
+#endif
+    
+#if defined(EONVSET_LAZYINIT_WAIT)
+    s_eo_nvset_lazyinit_frames = frame->prev;
+#else
+    frame = frame;
+#endif
+}
+
+
+static void s_eo_nvset_lazyinit_entity(EOnvSet* p, eOnvset_ep_t* theEndpoint, eOnvENT_t ent, uint8_t index)
+{
+    eOnvEP8_t ep08 = theEndpoint->epcfg.endpoint;
+    uint8_t brd = p->theboard.boardnum;
+    uint8_t tagsnumberof = 0;
+    uint8_t tag = 0;
+    uint16_t slot = 0;
+    uint32_t toinit = 0;
+    eOnvset_lazyinit_frame_t frame = {0};
+    
+    if((ent >= eoprot_entities_maxnumberofsupported) || (index >= theEndpoint->epcfg.numberofentities[ent]))
+    {
+        return;
+    }
+    
+    slot = theEndpoint->entityfirstinstance[ent]+index;
+    
+    if(0 != ((theEndpoint->entitiesinitted[slot >> 4] >> ((slot & 15) << 1)) & eo_nvset_lazyinit_done))
+    {   // the most common situation: already initted
+        EONVSET_LAZYINIT_BARRIER();
+        return;
+    }
+    
+    // as in s_eo_nvset_NVsOfEP_Initialise(): first the initialiser of the endpoint and then the init of every nv. we do it 
+    // before we take the entity, so that an initialiser of the endpoint which accesses an entity never waits for a thread
+    // which waits for the initialiser.
+    if(eobool_true == s_eo_nvset_lazyinit_begin(theEndpoint, theEndpoint->entitiesnumberof, &frame))
+    {
+        eOvoid_fp_uint32_voidp_t initialise = eoprot_endpoint_get_initialiser(ep08);
+        if(NULL != initialise)
+        {
+            initialise(p->theboard.ipaddress, theEndpoint->epram);
+        }
+        theEndpoint->initted = eobool_true;
+        s_eo_nvset_lazyinit_end(theEndpoint, theEndpoint->entitiesnumberof, &frame);
+    }
+    
+    if(eobool_false == s_eo_nvset_lazyinit_begin(theEndpoint, slot, &frame))
+    {
+        return;
+    }
+    
+    tagsnumberof = theEndpoint->entitytagsnumberof[ent];
+    for(tag=0; tag<tagsnumberof; tag++)
+    {
+        EOnv thenv = {0};
+        eOnvset_nvresolved_t* resolved = &theEndpoint->nvsresolved[theEndpoint->entityfirstprognum[ent] + index*tagsnumberof + tag];
+        eOnvID32_t id32 = eoprot_ID_get(ep08, ent, index, tag);
+        
+        if((NULL == resolved->rom) || (NULL == resolved->ram))
+        {
+            continue;
+        }
+        
+        eo_nv_hid_Load(&thenv, p->theboard.ipaddress, brd, eoprot_variable_is_proxied(brd, id32), id32, eoprot_onsay_endpoint_get(ep08), resolved->rom, resolved->ram, resolved->mtx);
+        eo_nv_Init(&thenv);
+    }
+    
+    s_eo_nvset_lazyinit_end(theEndpoint, slot, &frame);
+    
+    // when all the entities are initted we dont need to be called by eoprot anymore
+#if defined(EO_ATOMIC_AVAILABLE)
+    for(;;)
+    {
+        toinit = theEndpoint->entitiestoinit;
+        if(EO_atomic_cas32(&theEndpoint->entitiestoinit, toinit, toinit-1))
+        {
+            break;
+        }
+    }
+    toinit --;
+#else
+    toinit = -- theEndpoint->entitiestoinit;
+#endif
+    if(0 == toinit)
+    {
+        eoprot_config_endpoint_onentityaccess(brd, ep08, NULL, NULL);
+    }
+}
+
+
+static void s_eo_nvset_lazyinit_all(EOnvSet* p, eOnvset_ep_t* theEndpoint)
+{
+    uint16_t ent = 0;
+    uint16_t index = 0;
+    
+    for(ent=0; ent<eoprot_entities_maxnumberofsupported; ent++)
+    {
+        for(index=0; index<theEndpoint->epcfg.numberofentities[ent]; index++)
+        {
+            s_eo_nvset_lazyinit_entity(p, theEndpoint, ent, index);
+        }
+    }
+}
+
+
+static void s_eo_nvset_onentityaccess(void* arg, eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotIndex_t index)
+{
+    EOnvSet* p = (EOnvSet*)arg;
+    eOnvset_ep_t* theEndpoint = s_eo_nvset_get_endpoint(p, ep);
+    
+    brd = brd;
+    
+    if((NULL != theEndpoint) && (NULL != theEndpoint->entitiesinitted))
+    {
+        s_eo_nvset_lazyinit_entity(p, theEndpoint, entity, index);
+    }
+}
+
+
 uint16_t s_eonvset_EP2INDEX(EOnvSet* p, uint8_t ep08)
 {
     eOnvset_brd_t* theBoard = &p->theboard;
@@ -100,9 +100,32 @@ typedef enum
     eo_nvset_protection_none               = 0,    /**< we dont protect vs concurrent access at all */
     eo_nvset_protection_one_per_board      = 2,    /**< all the NVs in a booard share the same mutex */
     eo_nvset_protection_one_per_endpoint   = 3,    /**< all the NVs in an endpoint inside each board share the same mutex */
-    eo_nvset_protection_one_per_netvar     = 4     /**< every NV has its own mutex: heavy use of memory but maximum concurrency */
+    eo_nvset_protection_one_per_netvar     = 4,    /**< every NV has its own mutex: heavy use of memory but maximum concurrency */
+    eo_nvset_protection_seqlock            = 5,    /**< no mutex: every entity has a sequence counter, the writers increment it and the readers
+                                                        copy until they see it unchanged, so that they never block the writers. it does not need 
+                                                        the mutex_fn_new and it is meant for multi-core hosts. it is a fatal error 
+                                                        where EO_ATOMIC_AVAILABLE is not defined */
+    eo_nvset_protection_striped            = 6     /**< the board has a small array of mutexes and the id32 of every NV chooses one of them: 
+                                                        almost the concurrency of one_per_netvar at the memory cost of a few mutexes */
 } eOnvset_protection_t;
 
+enum { eo_nvset_stripes_default = 16, eo_nvset_stripes_max = 1024 };
+
+
+/** @typedef    typedef struct eOnvset_EPramprovider_t
+    @brief      It allows to place the ram of the endpoints outside the heap, for instance in a shared memory segment.
+                get() is called by eo_nvset_LoadEP() and must return at least sizeofram bytes, or NULL to use the heap. 
+                It can also return an array of sequence counters, one per entity of the endpoint (ordered by entity and then
+                by index), which the nvs increment before and after every write of their ram. release() is called when the
+                endpoint is unloaded.
+ **/ 
+typedef struct
+{
+    void*       (*get)(void* arg, eOnvBRD_t brd, eOnvEP8_t ep, uint16_t sizeofram, volatile uint32_t** entityseqlocks);
+    void        (*release)(void* arg, eOnvBRD_t brd, eOnvEP8_t ep, void* ram);
+    void*       arg;
+} eOnvset_EPramprovider_t;
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -125,6 +148,21 @@ extern eOresult_t eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, eOi
 
 extern eOresult_t eo_nvset_LoadEP(EOnvSet* p, eOprot_EPcfg_t *cfgofep, eObool_t initNVs);
 
+// it sets the number of mutexes used by eo_nvset_protection_striped. it must be called before eo_nvset_InitBRD(), 
+// otherwise it is used eo_nvset_stripes_default.
+extern eOresult_t eo_nvset_ProtectionStripes_Set(EOnvSet* p, uint16_t numberofstripes);
+
+// it must be called before eo_nvset_LoadEP(). after it, eo_nvset_LoadEP() with initNVs true does not initialise the nvs of the endpoint.
+// the nvs of an entity are initialised at the first access to the entity done with eo_nvset_NV_Get(), eo_nvset_RAMofEntity_Get(),
+// eo_nvset_RAMofVariable_Get(), eoprot_entity_ramof_get() or eoprot_variable_ramof_get(). the initialiser of the endpoint is called 
+// at the first access to any of its entities. eo_nvset_RAMofEndpoint_Get() and eo_nvset_NVSinitialise() initialise all the entities.
+// on the hosts, who accesses an entity while another thread initialises it waits for the end of the init. hence, the init of an 
+// entity must not access another entity which another thread may be initialising at the same time.
+extern eOresult_t eo_nvset_LazyInit_Enable(EOnvSet* p);
+
+// it must be called before any eo_nvset_LoadEP(). if provider is NULL, the ram of the endpoints is taken from the heap.
+extern eOresult_t eo_nvset_EPramProvider_Set(EOnvSet* p, const eOnvset_EPramprovider_t* provider);
+
 // it calls eo_nvset_InitBRD() and then for all the endpoint descriptors inside cfgofdev: { eo_nvset_EPcfg_IsValid() and eo_nvset_LoadEP() }
 extern eOresult_t eo_nvset_InitBRD_LoadEPs(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvset_BRDcfg_t* cfgofdev, eObool_t initNVs);
 
@@ -138,6 +176,19 @@ extern eOresult_t eo_nvset_BRD_Get(EOnvSet* p, eOnvBRD_t* brd);
 
 extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv);
 
+// it enables the tracking of writes of the nvs: every endpoint gets one dirty flag per nv, which is set by eo_nv_Set() and
+// by the rop parser and is cleared when the regulars of a EOtransmitter copy the nv into their ropframe. in this way 
+// the regulars copy only the nvs which have changed. it must be called before the nvs are used by the transmitter.
+// WARNING: the code which writes the ram of a nv directly (e.g., with eo_nv_RAM() or eoprot_variable_ramof_get()) must 
+// then call eo_nvset_NV_MarkDirty(), otherwise the regulars keep on transmitting the old value.
+extern eOresult_t eo_nvset_DirtyTracking_Enable(EOnvSet* p);
+extern eOresult_t eo_nvset_NV_MarkDirty(EOnvSet* p, eOnvID32_t id32);
+
+// the nvset keeps for each endpoint the result of eoprot_variable_is_proxied() for all its nvs, so that eo_nvset_NV_Get() does not 
+// call the function configured with eoprot_config_proxied_variables() every time. a new call of eoprot_config_proxied_variables() 
+// is detected automatically, but if the result of the configured function changes in runtime then this function must be called.
+extern eOresult_t eo_nvset_ProxiedVariables_Invalidate(EOnvSet* p);
+
 extern void* eo_nvset_RAMofEndpoint_Get(EOnvSet* p, eOnvEP8_t ep8);
 
 extern void* eo_nvset_RAMofEntity_Get(EOnvSet* p, eOnvEP8_t ep8, eOnvENT_t ent, uint8_t index);
@@ -49,15 +49,36 @@ extern "C" {
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
+// what eo_nvset_NV_Get() needs to load a nv, resolved once in eo_nvset_LoadEP()
+typedef struct
+{
+    EOnv_rom_t*                         rom;
+    void*                               ram;
+    EOVmutexDerived*                    mtx;
+} eOnvset_nvresolved_t;
+
 typedef struct
 {
     eOprot_EPcfg_t                      epcfg;
     uint16_t                            epnvsnumberof;
     eObool_t                            initted;
-    uint8_t                             dummy; 
+    eObool_t                            epramprovided;      // if eobool_true, epram was given by eOnvset_EPramprovider_t::get()
     void*                               epram;    
     EOVmutexDerived*                    mtx_endpoint;    
     EOvector*                           themtxofthenvs;    
+    uint8_t*                            nvsdirtyflags;      // one byte per nv (indexed by prognum) or NULL if dirty tracking is not enabled
+    eOnvset_nvresolved_t*               nvsresolved;        // one item per nv (indexed by prognum)
+    uint32_t*                           nvsproxied;         // one bit per nv (indexed by prognum) with the result of eoprot_variable_is_proxied()
+    uint32_t                            nvsproxiedchanges;  // the eoprot_config_proxied_variables_changes_get() when nvsproxied was evaluated
+    eObool_t                            nvsproxiedvalid;    
+    uint16_t                            entityfirstprognum[eoprot_entities_maxnumberofsupported];
+    volatile uint32_t*                  entityseqlocks;     // one counter per entity (entity and then index) or NULL
+    eObool_t                            entityseqlocksowned; // if eobool_true, entityseqlocks was allocated by the EOnvSet
+    uint16_t                            entityfirstinstance[eoprot_entities_maxnumberofsupported];  // position of the entity in the arrays ordered by entity and then index
+    uint16_t                            entitiesnumberof;   // the sum of epcfg.numberofentities[]
+    volatile uint32_t*                  entitiesinitted;    // two bits per entity (entity and then index) plus two for the initialiser of the endpoint, or NULL if not lazy
+    volatile uint32_t                   entitiestoinit;
+    uint8_t                             entitytagsnumberof[eoprot_entities_maxnumberofsupported];  // 0 if the entity is not in the endpoint
 } eOnvset_ep_t;
 
 
@@ -68,6 +89,8 @@ typedef struct
     eOnvsetOwnership_t              ownership;
     EOvector*                       theendpoints;       // of eOnvset_ep_t items
     EOVmutexDerived*                mtx_board;    
+    EOVmutexDerived**               mtx_stripes;        // numberofstripes mutexes if protection is eo_nvset_protection_striped
+    uint16_t                        numberofstripes;
     uint16_t                        ep2indexlut[eonvset_max_endpoint_value+1];    
 } eOnvset_brd_t;
 
@@ -84,6 +107,10 @@ struct EOnvSet_hid
     eOnvset_brd_t                   theboard;
     eOnvset_protection_t            protection;
     eov_mutex_fn_mutexderived_new   mtxderived_new;
+    eObool_t                        dirtytracking;
+    eOnvset_EPramprovider_t         epramprovider;
+    uint16_t                        numberofstripes;
+    eObool_t                        lazyinit;
 };   
  
 
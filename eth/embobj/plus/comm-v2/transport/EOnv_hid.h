@@ -73,7 +73,9 @@ struct EOnv_hid                    // 28 bytes ...
     EOnv_rom_t*                     rom;        // pointer to the constant part common to every device which uses this nv
     void*                           ram;        // the ram which keeps the LOCAL value of nv 
     EOVmutexDerived*                mtx;        // the mutex which protects concurrent access to the ram of this nv 
-};  //EO_VERIFYsizeof(EOnv, 28)   
+    uint8_t*                        dirty;      // if not NULL, the flag which is set to 1 at each write of the ram and cleared by who copies it (the regulars)
+    volatile uint32_t*              seqlock;    // if not NULL, the sequence counter of the entity of the nv. it is odd while the ram is being written
+};  //EO_VERIFYsizeof(EOnv, 32)   
 
 
 
@@ -89,8 +91,21 @@ struct EOnv_hid                    // 28 bytes ...
 
 extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eObool_t proxied, eOnvID32_t id32, eOvoid_fp_cnvp_cropdesp_t onsay, EOnv_rom_t* rom, void* ram, EOVmutexDerived* mtx);
 
+extern void eo_nv_hid_LoadDirtyFlag(EOnv *nv, uint8_t* dirty);
+
+// every write of the ram done by the EOnv increments seqlock before and after the copy, and the reads of the ram copy it
+// until seqlock is even and unchanged, without taking the mutex. without EO_ATOMIC_AVAILABLE the writers must be serialised
+// by the mutex of the nv or by having a single writer thread, as it happens for the rx thread of a transceiver. a read gives up 
+// after 1000 tries with a warning to the EOtheErrorManager: eo_nv_Get() then returns eores_NOK_busy and 
+// eo_nv_hid_Fast_LocalMemoryGetIfDirty() keeps the nv dirty.
+extern void eo_nv_hid_LoadSeqLock(EOnv *nv, volatile uint32_t* seqlock);
+
 extern void eo_nv_hid_Fast_LocalMemoryGet(EOnv *nv, void* dest);
 
+// it copies the ram into dest only if the nv was written since last copy, and in such a case it returns eobool_true.
+// if the nv does not have a dirty flag, it always copies.
+extern eObool_t eo_nv_hid_Fast_LocalMemoryGetIfDirty(EOnv *nv, void* dest);
+
 extern eObool_t eo_nv_hid_isWritable(const EOnv *netvar);
 extern eObool_t eo_nv_hid_isLocal(const EOnv *netvar);
 extern eObool_t eo_nv_hid_isUpdateable(const EOnv *netvar);
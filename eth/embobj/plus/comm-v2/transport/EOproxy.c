@@ -148,7 +148,7 @@ extern EOproxy* eo_proxy_New(const eOproxy_cfg_t *cfg)
     
     retptr->transceiver = (EOtransceiver*) cfg->transceiver;
     
-    retptr->listofropdes    = (0 == cfg->capacityoflistofropdes) ? (NULL) : (eo_list_New(sizeof(eo_proxy_ropdes_plus_t), cfg->capacityoflistofropdes, NULL, 0, NULL, NULL));
+    retptr->listofropdes    = (0 == cfg->capacityoflistofropdes) ? (NULL) : (eo_list_NewContiguous(sizeof(eo_proxy_ropdes_plus_t), cfg->capacityoflistofropdes, NULL, 0, NULL, NULL));
     
     if(NULL != cfg->mutex_fn_new)
     {
@@ -71,6 +71,8 @@ static void s_eo_receiver_on_error_invalidframe(EOreceiver* p);
 
 static void s_eo_receiver_on_error_seqnumber(EOreceiver* p);
 
+static eOresult_t s_eo_receiver_process(EOreceiver *p, EOpacket *packet, uint16_t *numberofrops, eObool_t *seqnumerror, eOabstime_t *transmittedtime);
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -167,6 +169,101 @@ extern void eo_receiver_Delete(EOreceiver *p)
 
 
 extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t *numberofrops, eObool_t *thereisareply, eOabstime_t *transmittedtime)
+{
+    eObool_t seqnumerror = eobool_false;
+    
+    if((NULL == p) || (NULL == packet)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    // clear the ropframereply w/ eo_ropframe_Clear(). the clear operation also makes it safe to manipulate p->ropframereplay with *_quickversion
+    
+    eo_ropframe_Clear(p->ropframereply);
+    
+    if(eores_OK != s_eo_receiver_process(p, packet, numberofrops, &seqnumerror, transmittedtime))
+    {
+        if(NULL != thereisareply)
+        {
+            *thereisareply = eobool_false;
+        }
+        return(eores_NOK_generic);
+    }
+    
+    // if any rop inside ropframereply w/ eo_ropframe_ROP_NumberOf() then sets thereisareply  
+    if(NULL != thereisareply)
+    {
+        *thereisareply = (0 == eo_ropframe_ROP_NumberOf(p->ropframereply)) ? (eobool_false) : (eobool_true);
+        // dont use the quickversion because it may be that ropframereply is dummy
+        //*thereisareply = (0 == eo_ropframe_ROP_NumberOf_quickversion(p->ropframereply)) ? (eobool_false) : (eobool_true);
+    } 
+    
+    return(eores_OK);   
+}
+
+
+extern eOresult_t eo_receiver_ProcessBatch(EOreceiver *p, EOpacket **packets, uint16_t numberofpackets, eOreceiver_packetresult_t *results, 
+                                           eOreceiver_batchcounters_t *counters, eOreceiver_fp_onreply_t onreply, void *param)
+{
+    eOreceiver_packetresult_t result = {0};
+    eOreceiver_batchcounters_t cnt = {0};
+    eOresult_t res = eores_OK;
+    uint16_t i = 0;
+    
+    if((NULL == p) || (NULL == packets)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    eo_ropframe_Clear(p->ropframereply);
+    
+    for(i=0; i<numberofpackets; i++)
+    {
+        result.numberofrops = 0;
+        result.seqnumerror = eobool_false;
+        result.transmittedtime = 0;
+        
+        result.result = (NULL == packets[i]) ? (eores_NOK_nullpointer) : (s_eo_receiver_process(p, packets[i], &result.numberofrops, &result.seqnumerror, &result.transmittedtime));
+        
+        cnt.packets ++;
+        if(eores_OK != result.result)
+        {
+            cnt.invalidpackets ++;
+            res = eores_NOK_generic;
+        }
+        else
+        {
+            cnt.rops += result.numberofrops;
+            cnt.seqnumerrors += (eobool_true == result.seqnumerror) ? (1) : (0);
+            
+            // the replies of this packet are given away and the ropframe is cleared only if it is not empty
+            if(0 != eo_ropframe_ROP_NumberOf(p->ropframereply))
+            {
+                cnt.packetswithreplies ++;
+                if(NULL != onreply)
+                {
+                    onreply(param, p->ropframereply);
+                }
+                eo_ropframe_Clear(p->ropframereply);
+            }
+        }
+        
+        if(NULL != results)
+        {
+            results[i] = result;
+        }
+    }
+    
+    if(NULL != counters)
+    {
+        *counters = cnt;
+    }
+    
+    return(res);
+}
+
+
+static eOresult_t s_eo_receiver_process(EOreceiver *p, EOpacket *packet, uint16_t *numberofrops, eObool_t *seqnumerror, eOabstime_t *transmittedtime)
 {
     uint16_t rxremainingbytes = 0;
     uint16_t txremainingbytes = 0;
@@ -181,18 +278,10 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
     uint64_t rec_seqnum;
     uint64_t rec_ageoframe;
     uint16_t numofprocessedrops = 0;
+    eOropdescriptor_t ropview;
+    uint16_t ropviewsize = 0;
 
-    
-    if((NULL == p) || (NULL == packet)) 
-    {
-        return(eores_NOK_nullpointer);
-    }
-    
-    
-    // clear the ropframereply w/ eo_ropframe_Clear(). the clear operation also makes it safe to manipulate p->ropframereplay with *_quickversion
-    
-    eo_ropframe_Clear(p->ropframereply);
-    
+    *seqnumerror = eobool_false;
     
     // we get the ip address and port of the incoming packet.
     // the remaddr can be any. however, if the eo_receiver_Process() is called by the EOtransceiver, it will be only the one of the remotehost
@@ -220,10 +309,6 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
         p->error_invalidframe.ropframe = p->ropframeinput;
         s_eo_receiver_on_error_invalidframe(p);
         
-        if(NULL != thereisareply)
-        {
-            *thereisareply = eobool_false;
-        }
         return(eores_NOK_generic);
     }
     
@@ -254,6 +339,7 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
             p->error_seqnumber.exp_seqnum =  p->rx_seqnum+1;
             p->error_seqnumber.timeoftxofcurrent = rec_ageoframe;
             p->error_seqnumber.timeoftxofprevious = p->tx_ageofframe;
+            *seqnumerror = eobool_true;
             
             s_eo_receiver_on_error_seqnumber(p);
         }
@@ -266,7 +352,23 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
     
     for(i=0; i<nrops; i++)
     {
-        // - get the rop w/ eo_ropframe_ROP_Parse()
+        // - at first try the fast path: the rop is decoded in place and given to the agent w/out any copy.
+        //   it works for sig<> and say<> w/out confirmation, which are the bulk of the traffic.
+        
+        if( (eores_OK == eo_ropframe_ROP_Peek(p->ropframeinput, &ropview, &ropviewsize)) && 
+            (eores_OK == eo_agent_InpROPprocessView(p->agent, &ropview)) )
+        {
+            numofprocessedrops++;            
+            eo_ropframe_ROP_Skip(p->ropframeinput, ropviewsize, &rxremainingbytes);
+            
+            if(0 == rxremainingbytes)
+            {
+                break;
+            }
+            continue;
+        }
+        
+        // - else get the rop w/ eo_ropframe_ROP_Parse(), which also reports the errors
               
         // if we have a valid ropinput the following eo_ropframe_ROP_Parse() returns OK. 
         // in all cases rxremainingbytes contains the number of bytes we still need to parse. in case of 
@@ -311,14 +413,6 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
     {
         *numberofrops = numofprocessedrops;
     }
-
-    // if any rop inside ropframereply w/ eo_ropframe_ROP_NumberOf() then sets thereisareply  
-    if(NULL != thereisareply)
-    {
-        *thereisareply = (0 == eo_ropframe_ROP_NumberOf(p->ropframereply)) ? (eobool_false) : (eobool_true);
-        // dont use the quickversion because it may be that ropframereply is dummy
-        //*thereisareply = (0 == eo_ropframe_ROP_NumberOf_quickversion(p->ropframereply)) ? (eobool_false) : (eobool_true);
-    } 
     
     if(NULL != transmittedtime)
     {
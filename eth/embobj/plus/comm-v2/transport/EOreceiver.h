@@ -91,6 +91,9 @@ typedef struct
 
 typedef void (*eOreceiver_void_fp_obj_t) (EOreceiver *);
 
+// it is called by eo_receiver_ProcessBatch() with the ropframe of the replies of a packet. the ropframe is cleared afterwards.
+typedef void (*eOreceiver_fp_onreply_t) (void *param, EOropframe *ropframereply);
+
 typedef struct
 {
     eOreceiver_void_fp_obj_t    onerrorseqnumber;       // argument is: EOreceiver*  
@@ -104,6 +107,23 @@ typedef struct
     eOreceiver_extfn_t      extfn;
 } eOreceiver_cfg_t;
 
+typedef struct
+{
+    eOresult_t      result;             // the same value eo_receiver_Process() would return
+    uint16_t        numberofrops;
+    eObool_t        seqnumerror;
+    eOabstime_t     transmittedtime;
+} eOreceiver_packetresult_t;
+
+typedef struct
+{
+    uint32_t        packets;
+    uint32_t        invalidpackets;
+    uint32_t        seqnumerrors;
+    uint32_t        rops;
+    uint32_t        packetswithreplies;
+} eOreceiver_batchcounters_t;
+
 
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
@@ -145,6 +165,23 @@ extern void eo_receiver_Delete(EOreceiver *p);
 extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t *numberofrops, eObool_t *thereisareply, eOabstime_t *transmittedtime);
 
 
+/** @fn         extern eOresult_t eo_receiver_ProcessBatch(EOreceiver *p, EOpacket **packets, uint16_t numberofpackets, eOreceiver_packetresult_t *results, 
+                                                       eOreceiver_batchcounters_t *counters, eOreceiver_fp_onreply_t onreply, void *param)
+    @brief      It processes an array of packets (e.g., filled by recvmmsg()) in the same way as eo_receiver_Process() called for each 
+                of them, but in a single call. The replies of each packet are given to @e onreply before the next packet is processed.
+    @param      p               the object.
+    @param      packets         the received packets.
+    @param      numberofpackets their number.
+    @param      results         if not NULL, an array of @e numberofpackets items which receives the result of each packet.
+    @param      counters        if not NULL, it receives the counters of the whole batch.
+    @param      onreply         if not NULL, it is called for every packet with replies. if NULL the replies are discarded.
+    @param      param           the first argument of @e onreply.
+    @return     eores_OK if all packets are valid, eores_NOK_generic if any is not, eores_NOK_nullpointer for NULL pointer errors.
+ **/
+extern eOresult_t eo_receiver_ProcessBatch(EOreceiver *p, EOpacket **packets, uint16_t numberofpackets, eOreceiver_packetresult_t *results, 
+                                           eOreceiver_batchcounters_t *counters, eOreceiver_fp_onreply_t onreply, void *param);
+
+
 /** @fn         extern eOresult_t eo_receiver_GetReply(EOreceiver *p, EOropframe **ropframereply, eOipv4addr_t *ipv4addr, eOipv4port_t *ipv4port)
     @brief      returns the frame to be transmitted back and the destination ip address and port.
     @param      p               the object.
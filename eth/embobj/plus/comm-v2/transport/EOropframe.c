@@ -112,6 +112,12 @@ static void s_eo_ropframe_footer_adjust(EOropframe *p);
 
 static const char s_eobj_ownname[] = "EOropframe";
 
+// the footer used in scatter-gather mode, where the footer does not follow the rops in memory
+static const EOropframeFooter_t s_eo_ropframe_footer = 
+{
+    EO_INIT(.endoframe)     EOFRAME_END
+};
+
 //static const uint16_t s_eo_ropframe_minimum_framesize = eo_ropframe_sizeforZEROrops;
 //(sizeof(EOropframeHeader_t)+sizeof(EOropframeFooter_t));
 
@@ -317,6 +323,67 @@ extern eOresult_t eo_ropframe_Append(EOropframe *p, EOropframe *rfr, uint16_t *r
     return(eores_OK);
 }
 
+extern eOresult_t eo_ropframe_ROPs_Segment(EOropframe *p, eOropframe_segment_t *segment)
+{
+    if(NULL == segment) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    segment->data = NULL;
+    segment->size = 0;
+    
+    if(eobool_false == eo_ropframe_IsValid(p))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    segment->data = s_eo_ropframe_rops_get(p);
+    segment->size = s_eo_ropframe_sizeofrops_get(p);
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_ropframe_HeaderFooter_Adjust(EOropframe *p, const eOropframe_segment_t *ropsegments, uint8_t numberofropsegments, uint16_t numberofrops, eOropframe_segment_t *header, eOropframe_segment_t *footer)
+{
+    uint8_t i = 0;
+    uint32_t sizeofrops = 0;
+    
+    if((NULL == header) || (NULL == footer) || ((NULL == ropsegments) && (0 != numberofropsegments))) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    // p must be valid and empty
+    if((eobool_false == eo_ropframe_IsValid(p)) || (0 != s_eo_ropframe_sizeofrops_get(p)))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    for(i=0; i<numberofropsegments; i++)
+    {
+        sizeofrops += ropsegments[i].size;
+    }
+    
+    // the same limit of eo_ropframe_Append(): the whole ropframe must be able to stay inside the capacity of p
+    if(p->capacity < (eo_ropframe_sizeforZEROrops+sizeofrops))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    // adjust the header. from now on the footer inside p is not valid anymore, thus we use the constant one
+    s_eo_ropframe_header_addrops(p, numberofrops, (uint16_t)sizeofrops);
+    
+    header->data = (const uint8_t*) s_eo_ropframe_header_get(p);
+    header->size = sizeof(EOropframeHeader_t);
+    footer->data = (const uint8_t*) &s_eo_ropframe_footer;
+    footer->size = sizeof(EOropframeFooter_t);
+
+    return(eores_OK);
+}
+
+
 extern eObool_t eo_ropframe_IsValid(EOropframe *p)
 {
     EOropframeHeader_t *header;
@@ -436,6 +503,53 @@ extern eOresult_t eo_ropframe_ROP_Parse(EOropframe *p, EOrop *rop, uint16_t *unp
     return(res);
 }
 
+
+extern eOresult_t eo_ropframe_ROP_Peek(EOropframe *p, eOropdescriptor_t *ropdes, uint16_t *ropsize)
+{
+    uint16_t unparsed = 0;
+    
+    if((NULL == p) || (NULL == ropdes) || (NULL == ropsize)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+        
+    unparsed = s_eo_ropframe_sizeofrops_get(p) - p->index2nextrop2beparsed;
+    
+    if(0 == unparsed)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    return(eo_parser_GetROPview(eo_parser_GetHandle(), s_eo_ropframe_rops_get(p) + p->index2nextrop2beparsed, unparsed, ropdes, ropsize));
+}
+
+
+extern eOresult_t eo_ropframe_ROP_Skip(EOropframe *p, uint16_t ropsize, uint16_t *unparsedbytes)
+{
+    uint16_t unparsed = 0;
+    
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    unparsed = s_eo_ropframe_sizeofrops_get(p) - p->index2nextrop2beparsed;
+    
+    if(ropsize > unparsed)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    p->index2nextrop2beparsed += ropsize;
+    
+    if(NULL != unparsedbytes)
+    {
+        *unparsedbytes = unparsed - ropsize;
+    }
+    
+    return(eores_OK);
+}
+
 //extern eObool_t eo_ropframe_ROP_CanAdd(EOropframe *p, const EOrop *rop)
 //{
 //    uint8_t* ropstream = NULL;
@@ -71,6 +71,17 @@ typedef struct EOropframe_hid EOropframe;
 typedef struct EOropframeData_hid EOropframeData;
 
 
+/** @typedef    typedef struct eOropframe_segment_t
+    @brief      it describes a contiguous piece of a ropframe when the ropframe is transmitted in scatter-gather mode: 
+                its header, the rops of one or more ropframes, its footer.
+ **/  
+typedef struct
+{
+    const uint8_t*  data;
+    uint16_t        size;
+} eOropframe_segment_t;
+
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 // empty-section
@@ -103,6 +114,15 @@ extern eOresult_t eo_ropframe_Clear(EOropframe *p);
 
 extern eOresult_t eo_ropframe_Append(EOropframe *p, EOropframe *rfr, uint16_t *remainingbytes);
 
+// it gives the segment which contains the rops of p, without header and footer. its size is zero if p has no rops.
+extern eOresult_t eo_ropframe_ROPs_Segment(EOropframe *p, eOropframe_segment_t *segment);
+
+// it is the scatter-gather version of eo_ropframe_Append(). p must be empty (just cleared) and it is used only to store the
+// header: its header is adjusted to describe the numberofrops rops contained in the ropsegments[] and it is returned in 
+// header together with the footer. the packet to transmit is then: header, ropsegments[0], ..., ropsegments[n-1], footer.
+// p stays in such a state until the next eo_ropframe_Clear().
+extern eOresult_t eo_ropframe_HeaderFooter_Adjust(EOropframe *p, const eOropframe_segment_t *ropsegments, uint8_t numberofropsegments, uint16_t numberofrops, eOropframe_segment_t *header, eOropframe_segment_t *footer);
+
 extern eObool_t eo_ropframe_IsValid(EOropframe *p);
 
 extern uint16_t eo_ropframe_ROP_NumberOf(EOropframe *p);
@@ -113,6 +133,13 @@ extern uint16_t eo_ropframe_ROP_NumberOf_quickversion(EOropframe *p);
 
 extern eOresult_t eo_ropframe_ROP_Parse(EOropframe *p, EOrop *rop, uint16_t *unparsedbytes);
 
+// it decodes in place the next rop to be parsed without advancing to the following one: ropdes->data points inside p.
+// it fails silently on an illegal rop, so that eo_ropframe_ROP_Parse() can be used to consume it and report the error. 
+extern eOresult_t eo_ropframe_ROP_Peek(EOropframe *p, eOropdescriptor_t *ropdes, uint16_t *ropsize);
+
+// it advances past the rop returned by eo_ropframe_ROP_Peek(), whose size is ropsize.
+extern eOresult_t eo_ropframe_ROP_Skip(EOropframe *p, uint16_t ropsize, uint16_t *unparsedbytes);
+
 
 //extern eObool_t eo_ropframe_ROP_CanAdd(EOropframe *p, const EOrop *rop);
 
@@ -151,6 +151,7 @@ extern EOtheBOARDtransceiver * eo_boardtransceiver_Initialise(const eOboardtrans
     txrxcfg.sizes.capacityofropframeoccasionals = cfg->sizes.capacityofropframeoccasionals;
     txrxcfg.sizes.capacityofropframereplies     = cfg->sizes.capacityofropframereplies;
     txrxcfg.sizes.maxnumberofregularrops        = cfg->sizes.maxnumberofregularrops;
+    txrxcfg.sizes.maxnumberofstagedrops         = cfg->sizes.maxnumberofstagedrops;
     txrxcfg.remipv4addr                         = cfg->remotehostipv4addr;
     txrxcfg.remipv4port                         = cfg->remotehostipv4port;
     txrxcfg.nvset                               = s_eo_theboardtrans.nvset;
@@ -66,6 +66,7 @@
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
 
+static eOparserResult_t s_eo_parser_rop_check(const uint8_t *streamdata, uint16_t streamsize, uint16_t *dataeffectivesize, uint16_t *parsedropsize);
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -114,7 +115,6 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
     uint8_t     *roptail            = NULL;
     uint16_t    dataeffectivesize   = 0; // multiple of four
     uint16_t    signeffectivesize   = 0;
-    uint16_t    timeeffectivesize   = 0;
     uint16_t    parsedropsize       = 0;
 
     if((NULL == p) || (NULL == streamdata) || (NULL == rop) || (NULL == consumedbytes) || (NULL == result))
@@ -129,103 +129,21 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
     // reset return data: rop and consumed bytes
     eo_rop_Reset(rop);
     *consumedbytes = 0;
-    *result = eo_parser_res_ok;
-
-    if(streamsize < eo_rop_minimumsize)
-    {
-        *result = eo_parser_res_nok_nostreamdata;
-        *consumedbytes = streamsize;
-        return(eores_NOK_generic);
-    }
-
-    // get the head of the rop with ctrl, ropc, endp, nvid, dsiz. 
-    // for now the roptail is just after the four bytes of the head
-    rophead = (eOrophead_t*)(&streamdata[0]);
-    roptail = (uint8_t*)(&streamdata[sizeof(eOrophead_t)]);
-    roptail = roptail;  // there is this instruction to force roptail to have its correct value in debugger
-
-    // check validity of ctrl
-    if(0 != rophead->ctrl.version)
-    {
-        // not managed yet
-        *result = eo_parser_res_nok_ropisillegal;    
-        *consumedbytes = streamsize;        
-        return(eores_NOK_generic);
-    }
-
-    // check validity of ropc 
     
-    if(eobool_false == eo_rop_ropcode_is_valid(rophead->ropc))
+    // verify the rop. in case of error parsedropsize tells how many bytes of the stream must be skipped
+    *result = s_eo_parser_rop_check(streamdata, streamsize, &dataeffectivesize, &parsedropsize);
+    if(eo_parser_res_ok != *result)
     {
-        *result = eo_parser_res_nok_ropisillegal;
-        *consumedbytes = streamsize;
+        *consumedbytes = parsedropsize;
         return(eores_NOK_generic);
     }
-     
-    // if the ropc requires data, the field datsize must be present
     
-    // some ropcodes also have a data field
-    if(eobool_true == eo_rop_datafield_is_required(rophead))
-    {
-        if(eobool_true == eo_rop_datafield_is_present(rophead))
-        {
-            ropdata = (uint8_t*)(&streamdata[sizeof(eOrophead_t)]);            
-        }
-        else
-        {   // the rop is not well formed
-            *result = eo_parser_res_nok_ropisillegal;
-            *consumedbytes = streamsize;
-            return(eores_NOK_generic);
-        }
-    }
-    else
-    {
-        ropdata = NULL;
-    }
-
-
-    // in case there is data field, verify it, and sets its effective length 
-    // remember that size and info must occupy 4, 8, 12, etc bytes.
-    if(NULL != ropdata)
-    {        
-        // we compute the effective size of data as the next multiple of four of dsiz
-        dataeffectivesize = eo_rop_datafield_effective_size(rophead->dsiz);
-        
-        // we make a first verification of size whcih at least tell us if the roptail is inside the stream
-        if(streamsize < (sizeof(eOrophead_t) + dataeffectivesize))
-        {   // the rop is too big to be contained inside the stream
-            *result = eo_parser_res_nok_ropisillegal;
-            *consumedbytes = streamsize;
-            return(eores_NOK_generic);
-        }
-			
-        // the roptail is after the bytes of the head and the bytes of the data
-        roptail = (uint8_t*)(&streamdata[sizeof(eOrophead_t) + dataeffectivesize]);           
-    }
-
-    
-    // in case there is sign and/or time presence, then sets the correct sizes
-
-    if(1 == rophead->ctrl.plussign)
-    {
-        signeffectivesize = 4;
-    }
-
-    if(1 == rophead->ctrl.plustime)
-    {
-        timeeffectivesize = 8;
-    }
-    
-    // the total size of the rop acording to info contained in the header is ...
-    parsedropsize = sizeof(eOrophead_t) + dataeffectivesize + signeffectivesize + timeeffectivesize;
-
-    // if we dont have enough bytes in the stream to accomodate  leave with an error
-    if(streamsize < parsedropsize)
-    {   // not enough bytes in the passed packet to keep the data suggested by the header
-        *result = eo_parser_res_nok_ropisillegal;
-        *consumedbytes = streamsize;
-        return(eores_NOK_generic);
-    }
+    // get the head of the rop with ctrl, ropc, endp, nvid, dsiz. some ropcodes also have a data field.
+    // the roptail is after the bytes of the head and the bytes of the data
+    rophead = (eOrophead_t*)(&streamdata[0]);
+    ropdata = (eobool_true == eo_rop_datafield_is_required(rophead)) ? ((uint8_t*)(&streamdata[sizeof(eOrophead_t)])) : (NULL);
+    roptail = (uint8_t*)(&streamdata[sizeof(eOrophead_t) + dataeffectivesize]);
+    signeffectivesize = (1 == rophead->ctrl.plussign) ? (4) : (0);
     
     // verify if we can accomodate the parsed rop in our buffer
     if(rop->stream.capacity < parsedropsize)
@@ -251,13 +169,13 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
 		
     
     // copy the signature
-    if(0 != signeffectivesize)
+    if(1 == rophead->ctrl.plussign)
     {
         rop->stream.sign = *( (uint32_t*) &roptail[0] );
     }
 
     // copy the time
-    if(0 != timeeffectivesize)
+    if(1 == rophead->ctrl.plustime)
     {
         rop->stream.time = *( (uint64_t*) &roptail[signeffectivesize] );
     }  
@@ -270,6 +188,41 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
 }
 
 
+extern eOresult_t eo_parser_GetROPview(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, eOropdescriptor_t *ropdes, uint16_t *ropsize)
+{
+    const eOrophead_t *rophead      = NULL;
+    const uint8_t *roptail          = NULL;
+    uint16_t    dataeffectivesize   = 0;
+    uint16_t    parsedropsize       = 0;
+    
+    if((NULL == p) || (NULL == streamdata) || (NULL == ropdes) || (NULL == ropsize))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(eo_parser_res_ok != s_eo_parser_rop_check(streamdata, streamsize, &dataeffectivesize, &parsedropsize))
+    {   // eo_parser_GetROP() will tell what is wrong
+        return(eores_NOK_generic);
+    }
+    
+    rophead = (const eOrophead_t*)(&streamdata[0]);
+    roptail = &streamdata[sizeof(eOrophead_t) + dataeffectivesize];
+    
+    // same values that eo_parser_GetROP() puts into the ropdes of the EOrop, but the data stays inside the stream
+    memcpy(&ropdes->control, &rophead->ctrl, sizeof(eOropctrl_t)); 
+    ropdes->ropcode     = rophead->ropc; 
+    ropdes->id32        = rophead->id32;
+    ropdes->size        = rophead->dsiz;
+    ropdes->data        = (eobool_true == eo_rop_datafield_is_required(rophead)) ? ((uint8_t*)(&streamdata[sizeof(eOrophead_t)])) : (NULL);
+    ropdes->signature   = (1 == rophead->ctrl.plussign) ? (*((const uint32_t*) &roptail[0])) : (EOK_uint32dummy);
+    ropdes->time        = (1 == rophead->ctrl.plustime) ? (*((const uint64_t*) &roptail[(1 == rophead->ctrl.plussign) ? (4) : (0)])) : (EOK_uint64dummy);
+    
+    *ropsize = parsedropsize;
+    
+    return(eores_OK);
+}
+
+
 
 
 
@@ -283,7 +236,69 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+static eOparserResult_t s_eo_parser_rop_check(const uint8_t *streamdata, uint16_t streamsize, uint16_t *dataeffectivesize, uint16_t *parsedropsize)
+{   
+    // verifies the rop at the start of the stream. if ok, it gives its total size and the effective size of its data field,
+    // else parsedropsize is the whole stream because we cannot tell where the next rop begins.
+    const eOrophead_t *rophead = NULL;
+    uint16_t size = 0;
+    
+    *dataeffectivesize = 0;
+    *parsedropsize = streamsize;
+
+    if(streamsize < eo_rop_minimumsize)
+    {
+        return(eo_parser_res_nok_nostreamdata);
+    }
+
+    rophead = (const eOrophead_t*)(&streamdata[0]);
+
+    // check validity of ctrl
+    if(0 != rophead->ctrl.version)
+    {   // not managed yet
+        return(eo_parser_res_nok_ropisillegal);
+    }
+
+    // check validity of ropc 
+    if(eobool_false == eo_rop_ropcode_is_valid(rophead->ropc))
+    {
+        return(eo_parser_res_nok_ropisillegal);
+    }
+     
+    // if the ropc requires data, the field datsize must be present. remember that data occupies 4, 8, 12, etc bytes.
+    if(eobool_true == eo_rop_datafield_is_required(rophead))
+    {
+        if(eobool_false == eo_rop_datafield_is_present(rophead))
+        {   // the rop is not well formed
+            return(eo_parser_res_nok_ropisillegal);
+        }
+        
+        // we compute the effective size of data as the next multiple of four of dsiz
+        *dataeffectivesize = eo_rop_datafield_effective_size(rophead->dsiz);
+        
+        // we make a first verification of size which at least tell us if the roptail is inside the stream
+        if(streamsize < (sizeof(eOrophead_t) + *dataeffectivesize))
+        {   // the rop is too big to be contained inside the stream
+            return(eo_parser_res_nok_ropisillegal);
+        }
+    }
+    
+    // the total size of the rop acording to info contained in the header is ...
+    size = sizeof(eOrophead_t) + *dataeffectivesize;
+    size += (1 == rophead->ctrl.plussign) ? (4) : (0);
+    size += (1 == rophead->ctrl.plustime) ? (8) : (0);
+
+    // if we dont have enough bytes in the stream to accomodate  leave with an error
+    if(streamsize < size)
+    {   // not enough bytes in the passed packet to keep the data suggested by the header
+        return(eo_parser_res_nok_ropisillegal);
+    }
+    
+    *parsedropsize = size;
+    
+    return(eo_parser_res_ok);
+}
 
 
 
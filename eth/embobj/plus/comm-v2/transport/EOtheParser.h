@@ -107,6 +107,20 @@ extern EOtheParser * eo_parser_GetHandle(void);
 extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, EOrop *rop, uint16_t *consumedbytes, eOparserResult_t *result);
 
 
+/** @fn         extern eOresult_t eo_parser_GetROPview(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, eOropdescriptor_t *ropdes, uint16_t *ropsize)
+    @brief      Decodes in place the ROP at the start of the stream without copying it into an EOrop. It applies the same checks
+                as eo_parser_GetROP() but it does not report the reason of failure.
+    @param      streamdata      The input data
+    @param      streamsize      The size of the input data
+    @param      ropdes          Filled with the description of the rop. Its data field points inside @e streamdata, hence
+                                it is valid only as long as the stream is not modified.
+    @param      ropsize         The number of bytes used by the rop.
+    @return     The value eores_NOK_nullpointer if any is a NULL pointer, eores_NOK_generic if streamdata does not have a valid rop, 
+                eores_OK if the function can fill @e ropdes.
+ **/
+extern eOresult_t eo_parser_GetROPview(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, eOropdescriptor_t *ropdes, uint16_t *ropsize);
+
+
 
 
 
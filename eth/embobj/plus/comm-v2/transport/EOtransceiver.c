@@ -29,6 +29,11 @@
 #include "EOropframe_hid.h"
 #include "EOnv_hid.h"
 #include "EOrop_hid.h"
+#include "EOagent_hid.h"
+#include "EOreceiver_hid.h"
+#include "EOtransmitter_hid.h"
+#include "EOproxy_hid.h"
+#include "EOconfirmationManager_hid.h"
 
 #include "EOVmutex.h"
 
@@ -69,7 +74,8 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section    
+
+static void s_eo_transceiver_onreply(void *param, EOropframe *ropframereply);
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -87,7 +93,8 @@ const eOtransceiver_cfg_t eo_transceiver_cfg_default =
         EO_INIT(.capacityofropframeregulars)    256,
         EO_INIT(.capacityofropframeoccasionals) 128,
         EO_INIT(.capacityofropframereplies)     128, 
-        EO_INIT(.maxnumberofregularrops)        16
+        EO_INIT(.maxnumberofregularrops)        16,
+        EO_INIT(.maxnumberofstagedrops)         0
     },    
     EO_INIT(.remipv4addr)                   EO_COMMON_IPV4ADDR_LOCALHOST,
     EO_INIT(.remipv4port)                   10001,
@@ -100,8 +107,8 @@ const eOtransceiver_cfg_t eo_transceiver_cfg_default =
     {
         EO_INIT(.onerrorseqnumber)          NULL,
         EO_INIT(.onerrorinvalidframe)       NULL
-    }
-    
+    },
+    EO_INIT(.arena)                         eobool_false
 };
 
 
@@ -120,6 +127,8 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg)
     eOreceiver_cfg_t rec_cfg;
     eOtransmitter_cfg_t tra_cfg;
     eOagent_cfg_t agentcfg = {0};
+    eOmempool_arena_t arena = {0};
+    eOmempool_arena_t *prevarena = NULL;
 
 
     if(NULL == cfg)
@@ -127,6 +136,12 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg)
         cfg = &eo_transceiver_cfg_default;
     }
     
+    if(eobool_true == cfg->arena)
+    {   // from now on the memory of all the objects is carved from a single block
+        eo_mempool_Arena_Init(eo_mempool_GetHandle(), &arena, eo_transceiver_ArenaSize_Get(cfg));
+        prevarena = eo_mempool_Arena_Activate(eo_mempool_GetHandle(), &arena);
+    }
+    
     
     // i get the memory for the object
     retptr = (EOtransceiver*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOtransceiver), 1);
@@ -198,6 +213,7 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg)
     tra_cfg.sizes.capacityofropframereplies     = cfg->sizes.capacityofropframereplies;
     tra_cfg.sizes.capacityofrop                 = cfg->sizes.capacityofrop;
     tra_cfg.sizes.maxnumberofregularrops        = cfg->sizes.maxnumberofregularrops;
+    tra_cfg.sizes.maxnumberofstagedrops         = cfg->sizes.maxnumberofstagedrops;
     tra_cfg.ipv4addr                            = cfg->remipv4addr;     // it is the address of the remote host: we filter incoming packet with this address and sends packets only to it
     tra_cfg.ipv4port                            = cfg->remipv4port;     // it is the remote port where to send packets
     tra_cfg.agent                               = retptr->agent;
@@ -213,6 +229,12 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg)
     memset(&retptr->debug, 0, sizeof(EOtransceiverDEBUG_t));
 #endif
     
+    if(eobool_true == cfg->arena)
+    {
+        eo_mempool_Arena_Activate(eo_mempool_GetHandle(), prevarena);
+        memcpy(&retptr->arena, &arena, sizeof(eOmempool_arena_t));
+    }
+    
     return(retptr);
 }
 
@@ -220,6 +242,9 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg)
 
 extern void eo_transceiver_Delete(EOtransceiver* p)
 {
+    eOmempool_arena_t arena = {0};
+    eOmempool_arena_t *prevarena = NULL;
+    
     if(NULL == p)
     {
         return;
@@ -230,6 +255,11 @@ extern void eo_transceiver_Delete(EOtransceiver* p)
         return;
     }
     
+    if(NULL != p->arena.data)
+    {   // the objects inside the arena are not released one by one. we copy it because p itself is inside it
+        memcpy(&arena, &p->arena, sizeof(eOmempool_arena_t));
+        prevarena = eo_mempool_Arena_Activate(eo_mempool_GetHandle(), &arena);
+    }
   
     eo_transmitter_Delete(p->transmitter);
     
@@ -250,10 +280,80 @@ extern void eo_transceiver_Delete(EOtransceiver* p)
     memset(p, 0, sizeof(EOtransceiver));
     
     eo_mempool_Delete(eo_mempool_GetHandle(), p);
+    
+    if(NULL != arena.data)
+    {
+        eo_mempool_Arena_Activate(eo_mempool_GetHandle(), prevarena);
+        eo_mempool_Arena_Release(eo_mempool_GetHandle(), &arena);
+    }
+    
     return;
 }
 
 
+extern uint32_t eo_transceiver_ArenaSize_Get(const eOtransceiver_cfg_t *cfg)
+{
+    uint32_t size = 0;
+    uint32_t smallobjects = 0;
+    uint32_t capacityofregularsubframes = 0;
+    uint32_t n = 0;
+    
+    if(NULL == cfg)
+    {    
+        cfg = &eo_transceiver_cfg_default;
+    }
+    
+    // the objects. they each may lose up to 8 bytes for the alignment, hence the +1 
+    size += sizeof(EOtransceiver) + sizeof(EOagent) + sizeof(EOreceiver) + sizeof(EOtransmitter);
+    smallobjects += 1;
+    
+    // the receiver: two ropframes, two rops and the buffer of the replies
+    smallobjects += 4;
+    size += 2*cfg->sizes.capacityofrop + cfg->sizes.capacityofropframereplies;
+    
+    // the transmitter: txpacket, six ropframes, roptmp and their buffers (see eo_transmitter_New())
+    smallobjects += 8;
+    capacityofregularsubframes = eo_ropframe_capacity2effectivecapacity(3*cfg->sizes.capacityofropframeregulars/4) + eo_ropframe_sizeforZEROrops;
+    size += cfg->sizes.capacityoftxpacket + cfg->sizes.capacityofrop + 3*capacityofregularsubframes;
+    size += cfg->sizes.capacityofropframeoccasionals + cfg->sizes.capacityofropframereplies;
+    
+    if(0 != cfg->sizes.maxnumberofregularrops)
+    {   // the list of the regulars and their index, which has a power of two capacity of at least twice the regulars
+        smallobjects += 1 + 2*cfg->sizes.maxnumberofregularrops;
+        size += cfg->sizes.maxnumberofregularrops * sizeof(eo_transm_regrop_info_t);
+        size += 4 * cfg->sizes.maxnumberofregularrops * sizeof(eo_transm_regrop_indexentry_t);
+    }
+    
+    if(0 != cfg->sizes.maxnumberofstagedrops)
+    {   // the slots of the staging area (power of two capacity) and their rops
+        n = 2 * cfg->sizes.maxnumberofstagedrops;
+        smallobjects += n;
+        size += n * (sizeof(eo_transm_stagedrop_t) + cfg->sizes.capacityofrop);
+    }
+    
+    if((NULL != cfg->mutex_fn_new) && (eo_trans_protection_enabled == cfg->protection))
+    {
+        smallobjects += 4;
+    }
+    
+    if((NULL != cfg->confmancfg) && (eoconfman_mode_disabled != cfg->confmancfg->mode))
+    {   // the object, its vector and its mutex
+        size += sizeof(EOconfirmationManager) + cfg->confmancfg->maxnumberofconfreqrops * sizeof(eOropdescriptor_t);
+        smallobjects += 4;
+    }
+    
+    if((NULL != cfg->proxycfg) && (eoproxy_mode_disabled != cfg->proxycfg->mode))
+    {   // the object, its list and its mutex. the items of the list are a eOropdescriptor_t plus a few words
+        size += sizeof(EOproxy) + cfg->proxycfg->capacityoflistofropdes * sizeof(eOropdescriptor_t);
+        smallobjects += 3 + 2*cfg->proxycfg->capacityoflistofropdes;
+    }
+    
+    size += smallobjects * eo_transceiver_arena_smallobject;
+    
+    return(size);
+}
+
+
 extern EOnvSet * eo_transceiver_GetNVset(EOtransceiver *p)
 {    
     if(NULL == p)
@@ -354,6 +454,35 @@ extern eOresult_t eo_transceiver_Receive(EOtransceiver *p, EOpacket *pkt, uint16
     return(res);
 }
 
+extern eOresult_t eo_transceiver_ReceiveBatch(EOtransceiver *p, EOpacket **pkts, uint16_t numberofpackets, eOreceiver_packetresult_t *results, eOreceiver_batchcounters_t *counters)
+{
+    eOipv4addr_t remaddr;
+    eOipv4port_t remport;
+    
+    if((NULL == p) || (NULL == pkts))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(0 == numberofpackets)
+    {
+        return(eores_OK);
+    }
+    
+    // as in eo_transceiver_Receive() but only once for the whole batch
+    eo_proxy_Tick(p->proxy);
+    
+    // the replies go back to the sender of the most recent packet, as if the packets were received one by one
+    if(NULL != pkts[numberofpackets-1])
+    {
+        eo_packet_Addressing_Get(pkts[numberofpackets-1], &remaddr, &remport);
+        eo_transmitter_outpacket_SetRemoteAddress(p->transmitter, remaddr,  remport);
+    }
+    
+    return(eo_receiver_ProcessBatch(p->receiver, pkts, numberofpackets, results, counters, s_eo_transceiver_onreply, p));
+}
+
+
 extern eOresult_t eo_transceiver_NumberofOutROPs(EOtransceiver *p, uint16_t *numberofreplies, uint16_t *numberofoccasionals, uint16_t *numberofregulars)
 {
     if(NULL == p)
@@ -399,6 +528,90 @@ extern eOresult_t eo_transceiver_outpacket_Get(EOtransceiver *p, EOpacket **pkt)
 }
 
 
+extern eOresult_t eo_transceiver_outpacket_PrepareSegments(EOtransceiver *p, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum)
+{  
+    eOresult_t res = eores_NOK_generic;
+    
+    if((NULL == p) || (NULL == numberofrops))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    res = eo_transmitter_outpacket_PrepareSegments(p->transmitter, numberofrops, ropsnum);
+    
+    // as in eo_transceiver_outpacket_Prepare()
+    eo_proxy_Tick(p->proxy);
+       
+    return(res);
+}
+
+
+extern eOresult_t eo_transceiver_outpacket_GetSegments(EOtransceiver *p, eOtransmitter_segments_t *segments)
+{    
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    return(eo_transmitter_outpacket_GetSegments(p->transmitter, segments)); 
+}
+
+
+extern eOresult_t eo_transceiver_Destination_Add(EOtransceiver *p, eOipv4addr_t ipv4addr, eOipv4port_t ipv4port)
+{    
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    return(eo_transmitter_destination_Add(p->transmitter, ipv4addr, ipv4port)); 
+}
+
+
+extern eOresult_t eo_transceiver_Destination_Remove(EOtransceiver *p, eOipv4addr_t ipv4addr, eOipv4port_t ipv4port)
+{    
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    return(eo_transmitter_destination_Remove(p->transmitter, ipv4addr, ipv4port)); 
+}
+
+
+extern uint8_t eo_transceiver_Destination_NumberOf(EOtransceiver *p)
+{    
+    if(NULL == p) 
+    {
+        return(0);
+    }
+    
+    return(eo_transmitter_destination_NumberOf(p->transmitter)); 
+}
+
+
+extern eOresult_t eo_transceiver_outpacket_GetForDestination(EOtransceiver *p, uint8_t destination, EOpacket **pkt)
+{    
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    return(eo_transmitter_outpacket_GetForDestination(p->transmitter, destination, pkt)); 
+}
+
+
+extern eOresult_t eo_transceiver_outpacket_GetSegmentsForDestination(EOtransceiver *p, uint8_t destination, eOtransmitter_segments_t *segments)
+{    
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    return(eo_transmitter_outpacket_GetSegmentsForDestination(p->transmitter, destination, segments)); 
+}
+
+
 extern eOresult_t eo_transceiver_RegularROPs_Clear(EOtransceiver *p)
 {
     eOresult_t res;
@@ -473,6 +686,30 @@ extern eOresult_t eo_transceiver_RegularROP_Load(EOtransceiver *p, eOropdescript
     res = eo_transmitter_regular_rops_Load(p->transmitter, ropdesc);
 
 
+#if defined(USE_DEBUG_EOTRANSCEIVER)     
+    {   // DEBUG    
+        if(eores_OK != res)
+        {
+            p->debug.cannotloadropinregulars ++;
+        }
+    } 
+#endif    
+    
+    return(res);
+}
+
+extern eOresult_t eo_transceiver_RegularROP_LoadWithPeriod(EOtransceiver *p, eOropdescriptor_t *ropdesc, uint8_t period)
+{
+    eOresult_t res;
+    
+    if((NULL == p) || (NULL == ropdesc))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    res = eo_transmitter_regular_rops_LoadWithPeriod(p->transmitter, ropdesc, period);
+
+
 #if defined(USE_DEBUG_EOTRANSCEIVER)     
     {   // DEBUG    
         if(eores_OK != res)
@@ -527,6 +764,17 @@ extern eOresult_t eo_transceiver_lasterror_tx_Get(EOtransceiver *p, int32_t *err
     return(eo_transmitter_lasterror_Get(p->transmitter, err, info0, info1, info2));    
 }
 
+
+extern eOresult_t eo_transceiver_SpillStatistics_Get(EOtransceiver *p, eOtransmitter_spillstatistics_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eo_transmitter_spill_Statistics_Get(p->transmitter, stats));    
+}
+
 extern eOresult_t eo_transceiver_OccasionalROP_Load(EOtransceiver *p, eOropdescriptor_t *ropdesc)
 {
     eOresult_t res;
@@ -602,7 +850,26 @@ extern eOresult_t eo_transceiver_LoadReplyInProxy(EOtransceiver *p, eOnvID32_t i
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+static void s_eo_transceiver_onreply(void *param, EOropframe *ropframereply)
+{
+    EOtransceiver *p = (EOtransceiver*) param;
+    eOresult_t res = eores_NOK_generic;
+    
+    // i will transmit back the replies to the remote host with the address of the p->transmitter
+    res = eo_transmitter_reply_ropframe_Load(p->transmitter, ropframereply);
+    
+#if defined(USE_DEBUG_EOTRANSCEIVER) 
+    {   // DEBUG
+        if(eores_OK != res)
+        {
+            p->debug.failuresinloadofreplyropframe ++;
+        }
+    }
+#else
+    res = res;
+#endif 
+}
 
 
 
@@ -82,6 +82,7 @@ typedef struct
     uint16_t        capacityofropframeoccasionals;
     uint16_t        capacityofropframereplies;
     uint16_t        maxnumberofregularrops;
+    uint16_t        maxnumberofstagedrops;
 } eOtransceiver_sizes_t; 
 
 
@@ -102,9 +103,13 @@ typedef struct
     eov_mutex_fn_mutexderived_new   mutex_fn_new;
     eOtransceiver_protection_t      protection;
     eOtransceiver_extfn_t           extfn;
+    eObool_t                        arena;          // if eobool_true, the transceiver and all its objects are placed in a single block (see below)
 } eOtransceiver_cfg_t;
 
 
+enum { eo_transceiver_arena_smallobject = 64 };
+
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -123,6 +128,13 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg);
 
 extern void eo_transceiver_Delete(EOtransceiver* p);
 
+// it returns the size of the block used when eOtransceiver_cfg_t::arena is eobool_true. the sizes of the buffers are exact, whereas 
+// every small object (ropframe, rop, list item, mutex, etc.) is given eo_transceiver_arena_smallobject bytes. what does not fit in the 
+// block is taken from the mempool as usual. with the arena, the transmitter and the receiver are contiguous in memory and 
+// eo_transceiver_Delete() gives back the whole block at once. the memory taken later (e.g., the one used by the spill or by the 
+// in-transit ropframes of the transmitter) is outside the arena.
+extern uint32_t eo_transceiver_ArenaSize_Get(const eOtransceiver_cfg_t *cfg);
+
 extern EOnvSet * eo_transceiver_GetNVset(EOtransceiver *p);
 
 extern EOproxy * eo_transceiver_GetProxy(EOtransceiver *p);
@@ -133,6 +145,10 @@ extern EOreceiver * eo_transceiver_GetReceiver(EOtransceiver *p);
 
 extern eOresult_t eo_transceiver_Receive(EOtransceiver *p, EOpacket *pkt, uint16_t *numberofrops, eOabstime_t* txtime); 
 
+// it is equivalent to eo_transceiver_Receive() called for each of the packets (e.g., filled by recvmmsg()), but the proxy is ticked 
+// and the remote address is set only once. see eo_receiver_ProcessBatch() for the results and the counters.
+extern eOresult_t eo_transceiver_ReceiveBatch(EOtransceiver *p, EOpacket **pkts, uint16_t numberofpackets, eOreceiver_packetresult_t *results, eOreceiver_batchcounters_t *counters); 
+
 extern eOresult_t eo_transceiver_NumberofOutROPs(EOtransceiver *p, uint16_t *numberofreplies, uint16_t *numberofoccasionals, uint16_t *numberofregulars);
 
 /** @fn         extern eOresult_t eo_transceiver_outpacket_Prepare(EOtransceiver *p, uint16_t *numberofrops)
@@ -153,7 +169,28 @@ extern eOresult_t eo_transceiver_outpacket_Prepare(EOtransceiver *p, uint16_t *n
  **/
 extern eOresult_t eo_transceiver_outpacket_Get(EOtransceiver *p, EOpacket **pkt);
 
+
+// scatter-gather versions of eo_transceiver_outpacket_Prepare() and eo_transceiver_outpacket_Get(). 
+// see eo_transmitter_outpacket_PrepareSegments() for the validity of the segments
+extern eOresult_t eo_transceiver_outpacket_PrepareSegments(EOtransceiver *p, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum);
+
+extern eOresult_t eo_transceiver_outpacket_GetSegments(EOtransceiver *p, eOtransmitter_segments_t *segments);
+
+// fan-out of the out packet to further destinations. see eo_transmitter_destination_Add()
+extern eOresult_t eo_transceiver_Destination_Add(EOtransceiver *p, eOipv4addr_t ipv4addr, eOipv4port_t ipv4port);
+
+extern eOresult_t eo_transceiver_Destination_Remove(EOtransceiver *p, eOipv4addr_t ipv4addr, eOipv4port_t ipv4port);
+
+extern uint8_t eo_transceiver_Destination_NumberOf(EOtransceiver *p);
+
+extern eOresult_t eo_transceiver_outpacket_GetForDestination(EOtransceiver *p, uint8_t destination, EOpacket **pkt);
+
+extern eOresult_t eo_transceiver_outpacket_GetSegmentsForDestination(EOtransceiver *p, uint8_t destination, eOtransmitter_segments_t *segments);
+
 extern eOresult_t eo_transceiver_lasterror_tx_Get(EOtransceiver *p, int32_t *err, int32_t *info0, int32_t *info1, int32_t *info2);
+
+// the deferred and dropped occasional and reply rops. see eo_transmitter_spill_Statistics_Get()
+extern eOresult_t eo_transceiver_SpillStatistics_Get(EOtransceiver *p, eOtransmitter_spillstatistics_t *stats);
     
 // if the variable is local then it is used the ram of the netvar. if it is remote, the ropdescr must contain data and size
 extern eOresult_t eo_transceiver_OccasionalROP_Load(EOtransceiver *p, eOropdescriptor_t *ropdes);
@@ -165,6 +202,7 @@ extern eOresult_t eo_transceiver_RegularROP_ArrayID32Get(EOtransceiver *p, uint1
 extern eOresult_t eo_transceiver_RegularROP_ArrayID32GetWithEP(EOtransceiver *p, eOnvEP8_t ep, uint16_t start, EOarray* array);
 extern eOresult_t eo_transceiver_RegularROPs_Clear(EOtransceiver *p);
 extern eOresult_t eo_transceiver_RegularROP_Load(EOtransceiver *p, eOropdescriptor_t *ropdes); 
+extern eOresult_t eo_transceiver_RegularROP_LoadWithPeriod(EOtransceiver *p, eOropdescriptor_t *ropdes, uint8_t period); 
 extern eOresult_t eo_transceiver_RegularROP_Entity_Unload(EOtransceiver *p, eOnvEP8_t ep8, eOnvENT_t ent);
 extern eOresult_t eo_transceiver_RegularROP_Unload(EOtransceiver *p, eOropdescriptor_t *ropdes); 
 
@@ -39,6 +39,7 @@ extern "C" {
 #include "EOreceiver.h"
 #include "EOtransmitter.h"
 #include "EOVmutex.h"
+#include "EOtheMemoryPool.h"
 
 
 // - declaration of extern public interface ---------------------------------------------------------------------------
@@ -78,6 +79,7 @@ struct EOtransceiver_hid
 #if defined(USE_DEBUG_EOTRANSCEIVER)    
     EOtransceiverDEBUG_t        debug;
 #endif    
+    eOmempool_arena_t           arena;          // it has non-NULL data if the object lives inside it
 }; 
 
 
@@ -85,15 +85,45 @@
 
 //static eOresult_t s_eo_transmitter_listmatching_rule(void *item, void *param);
 
-static eOresult_t s_eo_transmitter_entitymatchingrule_rule(void *item, void *param);
+static void s_eo_transmitter_list_updaterop_in_ropframe(void *item, void *param);
 
-static eOresult_t s_eo_transmitter_ropmatchingrule_rule(void *item, void *param);
+static void s_eo_transmitter_list_fixropstarthere(void *item, void *param);
 
-static void s_eo_transmitter_list_updaterop_in_ropframe(void *item, void *param);
+static void s_eo_transmitter_regropindex_init(EOtransmitter *p, uint16_t maxnumberofregularrops);
+
+static EOlistIter* s_eo_transmitter_regropindex_find(EOtransmitter *p, eOprotID32_t id32);
+
+static eOresult_t s_eo_transmitter_regropindex_insert(EOtransmitter *p, eOprotID32_t id32, EOlistIter *li);
+
+static void s_eo_transmitter_regropindex_remove(EOtransmitter *p, eOprotID32_t id32);
+
+static void s_eo_transmitter_regropindex_clear(EOtransmitter *p);
+
+static void s_eo_transmitter_regropoffsets_reset(EOtransmitter *p);
+
+static uint16_t s_eo_transmitter_regropoffsets_effective(EOtransmitter *p, const eo_transm_regrop_info_t *info);
+
+static void s_eo_transmitter_regropoffsets_fix(EOtransmitter *p);
+
+static void s_eo_transmitter_regrop_remove(EOtransmitter *p, EOlistIter *li);
+
+static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc, EOropframe* intoropframe, EOVmutexDerived *mtx, eo_transm_stagedrop_type_t stagedtype);
+
+static void s_eo_transmitter_staging_init(EOtransmitter *p, uint16_t maxnumberofstagedrops, uint16_t capacityofrop);
+
+static eOresult_t s_eo_transmitter_staging_put(EOtransmitter *p, EOnv *nv, eOropdescriptor_t* ropdesc, eo_transm_stagedrop_type_t type);
+
+static void s_eo_transmitter_staging_drain(EOtransmitter *p);
+
+static void s_eo_transmitter_intransit_init(EOtransmitter *p);
+
+static void s_eo_transmitter_intransit_swap(EOropframe *ropframe, EOropframe *intransit);
 
-static void s_eo_transmitter_list_shiftdownropinfo(void *item, void *param);
+static uint16_t s_eo_transmitter_segment_add(EOropframe *ropframe, eOropframe_segment_t *segments, uint8_t *numberofsegments, uint16_t *availablebytes);
 
-static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc, EOropframe* intoropframe, EOVmutexDerived *mtx);
+static void s_eo_transmitter_outpacket_finalise(EOtransmitter *p);
+
+static void s_eo_transmitter_segments_fill(EOtransmitter *p, eOtransmitter_segments_t *segments, eOipv4addr_t ipv4addr, eOipv4port_t ipv4port);
 
 static EOropframe * s_eo_transmitter_id32_to_typeofregulars(EOtransmitter* p, eOprotID32_t id32, eo_transm_regropframe_t *ropframetype);
 
@@ -102,11 +132,37 @@ static EOropframe * s_eo_transmitter_get_cycled_regropframe(EOtransmitter* p, ui
 
 static uint16_t s_eo_transmitter_get_maxsizeof_regularsropframe(EOtransmitter *p);
 
-static eObool_t s_eo_transmitter_regulars_canadd_rop(EOtransmitter *p, eo_transm_regropframe_t type, uint16_t ropbytes);
+static eObool_t s_eo_transmitter_regulars_canadd_rop(EOtransmitter *p, eo_transm_regropframe_t type, uint8_t period, uint8_t phase, uint16_t ropbytes);
 
 static void s_eo_transmitter_regulars_reset_sizes(EOtransmitter *p);
 
-static void s_eo_transmitter_regulars_update_sizes(EOtransmitter *p, eo_transm_regropframe_t type, int16_t ropbytes);
+static void s_eo_transmitter_regulars_update_sizes(EOtransmitter *p, eo_transm_regropframe_t type, uint8_t period, uint8_t phase, int16_t ropbytes);
+
+static eOresult_t s_eo_transmitter_regular_rops_load(EOtransmitter *p, eOropdescriptor_t* ropdesc, uint8_t period);
+
+static EOropframe * s_eo_transmitter_scheduled_init(EOtransmitter *p);
+
+static uint8_t s_eo_transmitter_scheduled_phase(EOtransmitter *p, uint8_t period);
+
+static uint16_t s_eo_transmitter_scheduled_maxbytes(EOtransmitter *p);
+
+static eObool_t s_eo_transmitter_scheduled_isdue(EOtransmitter *p, const eo_transm_regrop_info_t *info);
+
+static EOropframe * s_eo_transmitter_scheduled_collect(EOtransmitter *p, uint16_t *ropsinside);
+
+static uint16_t s_eo_transmitter_availablebytes(EOropframe *ropframe);
+
+static eObool_t s_eo_transmitter_spill_isneeded(EOtransmitter *p, eo_transm_spillclass_t cl, EOropframe *ropframe, uint16_t availablebytes);
+
+static uint16_t s_eo_transmitter_spill_numberof(EOtransmitter *p, eo_transm_spillclass_t cl);
+
+static void s_eo_transmitter_spill_init(EOtransmitter *p, eo_transm_spillclass_t cl, EOropframe *ropframe);
+
+static eObool_t s_eo_transmitter_spill_ishighpriority(const eOrophead_t *head);
+
+static eObool_t s_eo_transmitter_spill_contains(const uint8_t *data, uint16_t size, eOprotID32_t id32);
+
+static uint16_t s_eo_transmitter_spill_move(EOtransmitter *p, eo_transm_spillclass_t cl, EOropframe *ropframe, EOropframe *dest, uint16_t availablebytes);
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -124,7 +180,8 @@ const eOtransmitter_cfg_t eo_transmitter_cfg_default =
         EO_INIT(.capacityofropframeoccasionals) 256,
         EO_INIT(.capacityofropframereplies)     256,
         EO_INIT(.capacityofrop)                 128, 
-        EO_INIT(.maxnumberofregularrops)        16
+        EO_INIT(.maxnumberofregularrops)        16,
+        EO_INIT(.maxnumberofstagedrops)         0
     },
     EO_INIT(.ipv4addr)                      EO_COMMON_IPV4ADDR_LOCALHOST,
     EO_INIT(.ipv4port)                      10001,
@@ -178,8 +235,20 @@ extern EOtransmitter* eo_transmitter_New(const eOtransmitter_cfg_t *cfg)
     retptr->ropframeregulars_standard  = eo_ropframe_New();
     retptr->ropframeregulars_cycle0of  = eo_ropframe_New();
     retptr->ropframeregulars_cycle1of  = eo_ropframe_New();
+    retptr->ropframeregulars_scheduled = NULL;
+    retptr->ropframeregulars_scheduledtx = NULL;
+    retptr->bufferropframeregulars_scheduled = NULL;
+    retptr->bufferropframeregulars_scheduledtx = NULL;
     retptr->ropframeoccasionals     = eo_ropframe_New();
     retptr->ropframereplies         = eo_ropframe_New();
+    retptr->ropframeoccasionals_intransit = NULL;
+    retptr->ropframereplies_intransit = NULL;
+    retptr->bufferropframeoccasionals_intransit = NULL;
+    retptr->bufferropframereplies_intransit = NULL;
+    memset(retptr->spill, 0, sizeof(retptr->spill));
+    memset(retptr->destinations, 0, sizeof(retptr->destinations));
+    retptr->destinationsnumberof    = 0;
+    retptr->outsegmentsnumberof     = 0;
     retptr->roptmp                  = eo_rop_New(cfg->sizes.capacityofrop);
     retptr->agent                   = cfg->agent;
     retptr->nvset                   = eo_agent_GetNVset(cfg->agent);
@@ -197,7 +266,10 @@ extern EOtransmitter* eo_transmitter_New(const eOtransmitter_cfg_t *cfg)
     // TAG(*1234*) : end
     retptr->bufferropframeoccasionals = (0 == cfg->sizes.capacityofropframeoccasionals) ? (NULL) : ((uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, cfg->sizes.capacityofropframeoccasionals, 1));
     retptr->bufferropframereplies   = (0 == cfg->sizes.capacityofropframereplies) ? (NULL) : ((uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, cfg->sizes.capacityofropframereplies, 1));
-    retptr->listofregropinfo        = (0 == cfg->sizes.maxnumberofregularrops) ? (NULL) : (eo_list_New(sizeof(eo_transm_regrop_info_t), cfg->sizes.maxnumberofregularrops, NULL, 0, NULL, NULL));
+    retptr->listofregropinfo        = (0 == cfg->sizes.maxnumberofregularrops) ? (NULL) : (eo_list_NewContiguous(sizeof(eo_transm_regrop_info_t), cfg->sizes.maxnumberofregularrops, NULL, 0, NULL, NULL));
+    s_eo_transmitter_regropindex_init(retptr, cfg->sizes.maxnumberofregularrops);
+    s_eo_transmitter_regropoffsets_reset(retptr);
+    s_eo_transmitter_staging_init(retptr, cfg->sizes.maxnumberofstagedrops, cfg->sizes.capacityofrop);
     retptr->currenttime             = 0;
     retptr->tx_seqnum               = 0;
 
@@ -307,6 +379,11 @@ extern void eo_transmitter_Delete(EOtransmitter *p)
     {
         eo_list_Delete(p->listofregropinfo);
     }     
+    if(NULL != p->regropindex.entries)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->regropindex.entries);
+        p->regropindex.entries = NULL;
+    }
     if(NULL != p->bufferropframeregulars_standard)
     {
         eo_mempool_Delete(eo_mempool_GetHandle(), p->bufferropframeregulars_standard);
@@ -335,12 +412,60 @@ extern void eo_transmitter_Delete(EOtransmitter *p)
     
     eo_rop_Delete(p->roptmp);
     
+    if(NULL != p->staging.slots)
+    {
+        uint32_t i = 0;
+        for(i=0; i<p->staging.capacity; i++)
+        {
+            eo_rop_Delete(p->staging.slots[i].rop);
+        }
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->staging.slots);
+        p->staging.slots = NULL;
+    }
+    
     eo_ropframe_Delete(p->ropframereadytotx);
     eo_ropframe_Delete(p->ropframeregulars_standard);
     eo_ropframe_Delete(p->ropframeregulars_cycle0of);
     eo_ropframe_Delete(p->ropframeregulars_cycle1of);
+    if(NULL != p->ropframeregulars_scheduled)
+    {
+        eo_ropframe_Delete(p->ropframeregulars_scheduled);
+        eo_ropframe_Delete(p->ropframeregulars_scheduledtx);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->bufferropframeregulars_scheduled);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->bufferropframeregulars_scheduledtx);
+    }
     eo_ropframe_Delete(p->ropframeoccasionals);
     eo_ropframe_Delete(p->ropframereplies);
+    if(NULL != p->ropframeoccasionals_intransit)
+    {
+        eo_ropframe_Delete(p->ropframeoccasionals_intransit);
+    }
+    if(NULL != p->ropframereplies_intransit)
+    {
+        eo_ropframe_Delete(p->ropframereplies_intransit);
+    }
+    if(NULL != p->bufferropframeoccasionals_intransit)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->bufferropframeoccasionals_intransit);
+    }
+    if(NULL != p->bufferropframereplies_intransit)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->bufferropframereplies_intransit);
+    }
+    if(NULL != p->spill[eo_transm_spill_occasionals].ropframe)
+    {
+        eo_ropframe_Delete(p->spill[eo_transm_spill_occasionals].ropframe);
+        eo_ropframe_Delete(p->spill[eo_transm_spill_occasionals].ropframetmp);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->spill[eo_transm_spill_occasionals].buffer);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->spill[eo_transm_spill_occasionals].buffertmp);
+    }
+    if(NULL != p->spill[eo_transm_spill_replies].ropframe)
+    {
+        eo_ropframe_Delete(p->spill[eo_transm_spill_replies].ropframe);
+        eo_ropframe_Delete(p->spill[eo_transm_spill_replies].ropframetmp);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->spill[eo_transm_spill_replies].buffer);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->spill[eo_transm_spill_replies].buffertmp);
+    }
    
     eo_packet_Delete(p->txpacket);
         
@@ -575,175 +700,24 @@ extern eOresult_t eo_transmitter_regular_rops_arrayid32_ep_Get(EOtransmitter *p,
 
 extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc)
 {
-    eo_transm_regrop_info_t regropinfo;
-    eOropdescriptor_t ropdescriptor;
-    eOresult_t res;
-    uint16_t usedbytes;
-    uint16_t remainingbytes;
-    uint16_t ropstarthere;
-    uint16_t ropsize;
-    EOnv nv;
-    EOnv* tmpnvptr = NULL;
-    eo_transm_regropframe_t regropframe2use_type = eo_transm_regropframe_standard;
-    EOropframe* regropframe2use = NULL;
-
-    if((NULL == p) || (NULL == ropdesc)) 
-    {
-        return(eores_NOK_nullpointer);
-    }  
-
-    if(NULL == p->listofregropinfo)
-    {    // in such a case there is room for regular rops (for instance because the cfg->maxnumberofregularrops is zero)
-        return(eores_NOK_generic);
-    }
-    
-    
-    eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
-
-    // work on the list ...     
-    if(eobool_true == eo_list_Full(p->listofregropinfo))
-    {   // we have reached cfg->maxnumberofregularrops
-        eov_mutex_Release(p->mtx_regulars);
-        return(eores_NOK_generic);
-    }
-    
-
-    // for searching inside listofregropinfo we need only those three fields: ropcode, id, ep
-    ropdescriptor.ropcode   = ropdesc->ropcode;
-    ropdescriptor.id32      = ropdesc->id32;
+    return(s_eo_transmitter_regular_rops_load(p, ropdesc, 1));
+}
 
-    
-    // search for ropcode+ep+id. if found, then ... return a non NULL iterator and dont do anything because it means that the rop is already inside
-    if(NULL != eo_list_Find(p->listofregropinfo, s_eo_transmitter_ropmatchingrule_rule, &ropdescriptor))
-    {   // it is already inside ...
-        eov_mutex_Release(p->mtx_regulars);
-        return(eores_OK);
-    }    
-    
-    // else ... prepare a temporary variable eo_transm_regrop_info_t to be put inside the list.
-    // and wait success of rop + insetrtion in frame
-    
-    memcpy(&ropdescriptor, ropdesc, sizeof(eOropdescriptor_t));
-    ropdescriptor.control.rqstconf  = 0;                // VERY IMPORTANT: the regulars cannot ask for confirmation.
-    ropdescriptor.control.confinfo  = eo_ropconf_none;  // VERY IMPORTANT: the regulars cannot be a ack/nack
-    ropdescriptor.control.version   = EOK_ROP_VERSION_0;
-    
-      
-    res = eo_nvset_NV_Get(  (p->nvset),  
-                            ropdescriptor.id32,
-                            &nv
-                            );   
 
-    // if the nvset does not have the triple (ip, ep, id) then we return an error because we cannot form the rop
-    if(eores_OK != res)
+extern eOresult_t eo_transmitter_regular_rops_LoadWithPeriod(EOtransmitter *p, eOropdescriptor_t* ropdesc, uint8_t period)
+{
+    // the period must be a power of two not bigger than eo_transmitter_regrops_maxperiod
+    if((0 == period) || (period > eo_transmitter_regrops_maxperiod) || (0 != (period & (period-1))))
     {
-        eov_mutex_Release(p->mtx_regulars);
         return(eores_NOK_generic);
-    } 
-
-    // force size to be coherent with the nv. the size is always used, even if there is no data to transmit
-    ropdescriptor.size = eo_nv_Size(&nv);    
-    
-    // now we have the nv. we set its value in local ram
-    if(eobool_true == eo_rop_ropcode_has_data(ropdescriptor.ropcode))
-    { 
-        eOnvOwnership_t nvownership = eo_rop_get_ownership(ropdescriptor.ropcode, eo_ropconf_none, eo_rop_dir_outgoing);        
-        if(eo_nv_ownership_local == nvownership)
-        {   // if the nv is local, then take data from nv, thus no need to write the data field of the nv using ropdescriptor.data.
-            ropdescriptor.data = NULL;   // set ropdescriptor.data to NULL to force eo_agent_OutROPfromNV() to get data from EOnv
-        }
-        else
-        {   // if the nv is remote, then the data must be passed inside ropdescriptor.data
-            
-            // so far we dont support that the device regularly sends commands such as set<remotevar, value>. it can send ask<remotevar> however.
-            // marco.accame on Nov 17 2014: it can regularly sends a ask<remotevar>, even if this mechanisms is not used ... and maybe will never be used ...
-            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, "eo_transmitter_regular_rops_Load(): cant load a regular ROP of remote variable w/ payload", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
-            
-            eov_mutex_Release(p->mtx_regulars);
-            return(eores_NOK_generic);
-            
-            // however, if we allow a sending of rop<remotevar, value> ... we must have a descriptor.data not NULL
-            //if(NULL == ropdescriptor.data)
-            //{
-            //    eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_transmitter_regular_rops_Load(): cant have NULL ropdes->data if nv is remote", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
-            //}          
-        }
-    }
-    else
-    {   // dont need to send data
-        ropdescriptor.data = NULL;
-    }
-
-    // lock tmprop
-    eov_mutex_Take(p->mtx_roptmp, eok_reltimeINFINITE);
-    
-    res = eo_agent_OutROPprepare(p->agent, &nv, &ropdescriptor, p->roptmp, &usedbytes);   
-    
-    // if we cannot prepare the rop ... we quit
-    if(eores_OK != res)
-    {
-        eov_mutex_Release(p->mtx_roptmp);
-        eov_mutex_Release(p->mtx_regulars);
-        return(res);
-    }
-    
-
-    // extract the reference to the associated netvar
-    tmpnvptr = eo_rop_GetNV(p->roptmp);
-    
-
-    // choose the relevant regular ropframe. that depends on the id32 of the ropdescriptor 
-    regropframe2use = s_eo_transmitter_id32_to_typeofregulars(p, ropdescriptor.id32, &regropframe2use_type);
-    
-    // see if we have space for this rop. as we transmit always a standard with one between cycled0of / cycled1of, we need verify
-    // with knowledge of regropframe2use_type and of usedbytes. 
-    if(eobool_false == s_eo_transmitter_regulars_canadd_rop(p, regropframe2use_type, usedbytes))
-    {   // cannot load the rop because we dont have usedbytes anymore
-        eov_mutex_Release(p->mtx_roptmp);
-        eov_mutex_Release(p->mtx_regulars);
-        return(eores_NOK_generic);        
-    }
-           
-    // put the rop inside the relevant regular ropframe         
-    res = eo_ropframe_ROP_Add(regropframe2use, p->roptmp, &ropstarthere, &ropsize, &remainingbytes);
-    // if we cannot add the rop, then we quit ....
-    if(eores_OK != res)
-    {
-        eov_mutex_Release(p->mtx_roptmp);
-        eov_mutex_Release(p->mtx_regulars);
-        return(res);
     }
     
-    // i am sure that ropsize is equal to usedbytes, thus i dont verify with an assert ...
-    
-    // 3. prepare a regropinfo variable to be put inside the list    
-    regropinfo.ropcode                  = ropdescriptor.ropcode;    
-    regropinfo.hasdata2update           = eo_rop_datafield_is_present(&(p->roptmp->stream.head)); 
-    regropinfo.regropframetype          = regropframe2use_type;
-    regropinfo.ropframe                 = regropframe2use;
-    regropinfo.ropstarthere             = ropstarthere;
-    regropinfo.ropsize                  = ropsize;
-    regropinfo.timeoffsetinsiderop      = (0 == p->roptmp->stream.head.ctrl.plustime) ? (EOK_uint16dummy) : (ropsize - 8); //if we have time, then it is in teh last 8 bytes
-    memcpy(&regropinfo.thenv, tmpnvptr, sizeof(EOnv));
-
-
-    // push back regropinfo inside the list.
-    eo_list_PushBack(p->listofregropinfo, &regropinfo);
-    
-    // increment size of the relevant regular ropframe
-    s_eo_transmitter_regulars_update_sizes(p, regropframe2use_type, +regropinfo.ropsize); // with a + we increment
-    
-    eov_mutex_Release(p->mtx_roptmp);
-    eov_mutex_Release(p->mtx_regulars);  
-    
-    return(eores_OK);   
+    return(s_eo_transmitter_regular_rops_load(p, ropdesc, period));
 }
 
 
 extern eOresult_t eo_transmitter_regular_rops_Unload(EOtransmitter *p, eOropdescriptor_t* ropdesc)//eOropcode_t ropcode, eOnvEP_t nvep, eOnvID_t nvid)
 {
-    eo_transm_regrop_info_t regropinfo;
-    eOropdescriptor_t ropdescriptor;
     EOlistIter *li = NULL;
 
     if(NULL == p) 
@@ -767,38 +741,17 @@ extern eOresult_t eo_transmitter_regular_rops_Unload(EOtransmitter *p, eOropdesc
         return(eores_NOK_generic);
     }
     
-    // need only ropcode, ep and id to search for inside the list listofregropinfo
-    ropdescriptor.ropcode       = ropdesc->ropcode;
-    ropdescriptor.id32          = ropdesc->id32;
-
-      
-    // search for ropcode+nvep+nvid. if not found, then ... return OK and dont do anything.
-    li = eo_list_Find(p->listofregropinfo, s_eo_transmitter_ropmatchingrule_rule, &ropdescriptor);
+    // search for the id32 inside the index. if not found, then ... return NOK and dont do anything.
+    li = s_eo_transmitter_regropindex_find(p, ropdesc->id32);
     if(NULL == li)
     {   // it is not inside ...
         eov_mutex_Release(p->mtx_regulars);
         return(eores_NOK_generic);
     }
     
-    // copy what is inside the list into a temporary variable
-    memcpy(&regropinfo, eo_list_At(p->listofregropinfo, li), sizeof(eo_transm_regrop_info_t));
-    
-    // for each element after li: (name is afterli) retrieve it and modify its content so that ropstarthere is decremented by regropinfo.ropsize ...
-    // but only if ... the element is inside the same regropframe. that is done in function s_eo_transmitter_list_shiftdownropinfo()
-    eo_list_ExecuteFromIter(p->listofregropinfo, s_eo_transmitter_list_shiftdownropinfo, &regropinfo, eo_list_Next(p->listofregropinfo, li));
-    
-    // remove the element indexedby li
-    eo_list_Erase(p->listofregropinfo, li);
-    
-    // inside the p->ropframeregulars: remove a rop of regropinfo.ropsize which starts at regropinfo.ropstartshere. use a _friend method in here defined.
-    //                                 you must: decrement the nrops by 1, decrement the size by regropinfo.ropsize, ... else in header and private variable ...
-    //                                           and finally make a memmove down by regropinfo.ropsize.
-    
-
-    eo_ropframe_ROP_Rem(regropinfo.ropframe, regropinfo.ropstarthere, regropinfo.ropsize);
-    
-    // decrement the size of relevant ropframe
-    s_eo_transmitter_regulars_update_sizes(p, (eo_transm_regropframe_t)regropinfo.regropframetype, -regropinfo.ropsize); // with a -regropinfo.ropsize we decrement
+    // remove it from the list, from the index and from its ropframe. the rops which follow it inside the same ropframe
+    // are not touched: their shift is kept inside the offset table of the ropframe.
+    s_eo_transmitter_regrop_remove(p, li);
 
     eov_mutex_Release(p->mtx_regulars);
     
@@ -808,11 +761,10 @@ extern eOresult_t eo_transmitter_regular_rops_Unload(EOtransmitter *p, eOropdesc
 
 extern eOresult_t eo_transmitter_regular_rops_entity_Unload(EOtransmitter *p, eOnvEP8_t ep8, eOnvENT_t ent)
 {
-    eo_transm_regrop_info_t regropinfo;
     EOlistIter *li = NULL;
+    EOlistIter *next = NULL;
+    eo_transm_regrop_info_t *item = NULL;
     uint32_t id32 = 0;
-    uint8_t size = 0;
-    uint8_t i = 0;
 
     if(NULL == p) 
     {
@@ -835,39 +787,22 @@ extern eOresult_t eo_transmitter_regular_rops_entity_Unload(EOtransmitter *p, eO
         return(eores_NOK_generic);
     }
     
-    // need only ropcode, ep and id to search for inside the list listofregropinfo
+    // we match only the ep and the entity of the id32
     id32 = ((uint32_t)ep8 << 24) | ((uint32_t)ent << 16);
 
-      
-    size = eo_list_Size(p->listofregropinfo);
-    for(i=0; i<size; i++)
+    // a single walk of the list: we get the next iterator before removing the current one
+    li = eo_list_Begin(p->listofregropinfo);
+    while(NULL != li)
     {
-        // search for ropcode+nvep+nvid. if not found, then ... break.
-        li = eo_list_Find(p->listofregropinfo, s_eo_transmitter_entitymatchingrule_rule, &id32);
-        if(NULL == li)
-        {   // it is not inside ...
-            break;
-        }
-        
-        // copy what is inside the list into a temporary variable
-        memcpy(&regropinfo, eo_list_At(p->listofregropinfo, li), sizeof(eo_transm_regrop_info_t));
-        
-        // for each element after li: (name is afterli) retrieve it and modify its content so that ropstarthere is decremented by regropinfo.ropsize ...
-        // but only if ... the element is inside the same regropframe. that is done in function s_eo_transmitter_list_shiftdownropinfo()
-        eo_list_ExecuteFromIter(p->listofregropinfo, s_eo_transmitter_list_shiftdownropinfo, &regropinfo, eo_list_Next(p->listofregropinfo, li));
+        next = eo_list_Next(p->listofregropinfo, li);
+        item = (eo_transm_regrop_info_t*) eo_list_At(p->listofregropinfo, li);
         
-        // remove the element indexedby li
-        eo_list_Erase(p->listofregropinfo, li);
-        
-        // inside the p->ropframeregulars: remove a rop of regropinfo.ropsize which starts at regropinfo.ropstartshere. use a _friend method in here defined.
-        //                                 you must: decrement the nrops by 1, decrement the size by regropinfo.ropsize, ... else in header and private variable ...
-        //                                           and finally make a memmove down by regropinfo.ropsize.
-        
-
-        eo_ropframe_ROP_Rem(regropinfo.ropframe, regropinfo.ropstarthere, regropinfo.ropsize);
+        if((item->thenv.id32 & 0xffff0000) == id32)
+        {
+            s_eo_transmitter_regrop_remove(p, li);
+        }
         
-        // decrement the size of relevant ropframe
-        s_eo_transmitter_regulars_update_sizes(p, (eo_transm_regropframe_t)regropinfo.regropframetype, -regropinfo.ropsize); // with a -regropinfo.ropsize we decrement    
+        li = next;
     }
 
     eov_mutex_Release(p->mtx_regulars);
@@ -897,10 +832,16 @@ extern eOresult_t eo_transmitter_regular_rops_Clear(EOtransmitter *p)
     } 
     
     eo_list_Clear(p->listofregropinfo);
+    s_eo_transmitter_regropindex_clear(p);
+    s_eo_transmitter_regropoffsets_reset(p);
     
     eo_ropframe_Clear(p->ropframeregulars_standard);
     eo_ropframe_Clear(p->ropframeregulars_cycle0of);
     eo_ropframe_Clear(p->ropframeregulars_cycle1of);    
+    if(NULL != p->ropframeregulars_scheduled)
+    {
+        eo_ropframe_Clear(p->ropframeregulars_scheduled);
+    }
     
     s_eo_transmitter_regulars_reset_sizes(p);
 
@@ -932,8 +873,9 @@ extern eOresult_t eo_transmitter_regular_rops_Refresh(EOtransmitter *p)
     
     p->currenttime = eov_sys_LifeTimeGet(eov_sys_GetHandle());
     
-    // for each element in the list ... i do: ... see function
+    // for each element in the list ... i do: ... see function. it also fixes the pending shifts of the offset tables.
     eo_list_Execute(p->listofregropinfo, s_eo_transmitter_list_updaterop_in_ropframe, p);
+    s_eo_transmitter_regropoffsets_reset(p);
 
     eov_mutex_Release(p->mtx_regulars);
     
@@ -948,12 +890,15 @@ extern eOresult_t eo_transmitter_NumberofOutROPs(EOtransmitter *p, uint16_t *num
         return(eores_NOK_nullpointer);
     }  
     
+    // the staged occasionals and replies must be counted as well
+    s_eo_transmitter_staging_drain(p);
+    
     if(NULL != numberofreplies)
     {
         if(0 == (p->txdecimationprogressive % p->txdecimationreplies))
         {
             eov_mutex_Take(p->mtx_replies, eok_reltimeINFINITE);
-            *numberofreplies = eo_ropframe_ROP_NumberOf(p->ropframereplies);
+            *numberofreplies = eo_ropframe_ROP_NumberOf(p->ropframereplies) + s_eo_transmitter_spill_numberof(p, eo_transm_spill_replies);
             eov_mutex_Release(p->mtx_replies);
         }
         else
@@ -967,7 +912,7 @@ extern eOresult_t eo_transmitter_NumberofOutROPs(EOtransmitter *p, uint16_t *num
         if(0 == (p->txdecimationprogressive % p->txdecimationoccasionals))
         {
             eov_mutex_Take(p->mtx_occasionals, eok_reltimeINFINITE);
-            *numberofoccasionals = eo_ropframe_ROP_NumberOf(p->ropframeoccasionals);
+            *numberofoccasionals = eo_ropframe_ROP_NumberOf(p->ropframeoccasionals) + s_eo_transmitter_spill_numberof(p, eo_transm_spill_occasionals);
             eov_mutex_Release(p->mtx_occasionals);
         }
         else
@@ -984,8 +929,9 @@ extern eOresult_t eo_transmitter_NumberofOutROPs(EOtransmitter *p, uint16_t *num
             eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
             // we may have one of the cycled or not
             s_eo_transmitter_get_cycled_regropframe(p, &cycledrops);
-            // but the standard is alwyas added
+            // but the standard is alwyas added. and so are the scheduled rops of this tick
             *numberofregulars = eo_ropframe_ROP_NumberOf(p->ropframeregulars_standard) + cycledrops;
+            *numberofregulars += p->scheduledrops[p->txregularsprogressive % eo_transmitter_regrops_maxperiod];
             eov_mutex_Release(p->mtx_regulars);
         }
         else
@@ -1018,6 +964,7 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
     
     // clear the content of the ropframe to transmit which uses the same storage of the packet ...
     eo_ropframe_Clear(p->ropframereadytotx);
+    p->outsegmentsnumberof = 0;
     
 //    // add to it the ropframe of regulars. keep it afterwards. dont clear it !!!
 //    if(0 == (p->txdecimationprogressive % p->txdecimationregulars))
@@ -1104,6 +1051,14 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
             eo_ropframe_Append(p->ropframereadytotx, cycledregulars, &remainingbytes);
             nregulars += nregularscycled;
         }
+        
+        // and the scheduled ones which are due in this tick
+        cycledregulars = s_eo_transmitter_scheduled_collect(p, &nregularscycled);
+        if(NULL != cycledregulars)
+        {
+            eo_ropframe_Append(p->ropframereadytotx, cycledregulars, &remainingbytes);
+            nregulars += nregularscycled;
+        }
                 
         eov_mutex_Release(p->mtx_regulars);
         
@@ -1116,28 +1071,50 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
         p->txregularsprogressive ++;
     }
 
-    // add the ropframe of occasionals ... and then clear it
+    // move the staged occasionals and replies into their ropframes
+    s_eo_transmitter_staging_drain(p);
+
+    // add the ropframe of occasionals ... and then clear it. if it does not fit (or if some rops were spilled by the 
+    // previous packet) its rops are moved one by one in order of priority and what does not fit is spilled.
     if(0 == (p->txdecimationprogressive % p->txdecimationoccasionals))
     {
+        uint16_t n = 0;
         eov_mutex_Take(p->mtx_occasionals, eok_reltimeINFINITE);
+        if(eobool_false == s_eo_transmitter_spill_isneeded(p, eo_transm_spill_occasionals, p->ropframeoccasionals, s_eo_transmitter_availablebytes(p->ropframereadytotx)))
+        {
+            n = eo_ropframe_ROP_NumberOf(p->ropframeoccasionals);
+            eo_ropframe_Append(p->ropframereadytotx, p->ropframeoccasionals, &remainingbytes);
+        }
+        else
+        {
+            n = s_eo_transmitter_spill_move(p, eo_transm_spill_occasionals, p->ropframeoccasionals, p->ropframereadytotx, s_eo_transmitter_availablebytes(p->ropframereadytotx));
+        }
         if(NULL != ropsnum)
         {
-            ropsnum->numberofoccasionals = eo_ropframe_ROP_NumberOf(p->ropframeoccasionals);
+            ropsnum->numberofoccasionals = n;
         }
-        eo_ropframe_Append(p->ropframereadytotx, p->ropframeoccasionals, &remainingbytes);
         eo_ropframe_Clear(p->ropframeoccasionals);
         eov_mutex_Release(p->mtx_occasionals);
     }
 
-    // add the ropframe of replies ... and then clear it
+    // add the ropframe of replies ... and then clear it. as for the occasionals
     if(0 == (p->txdecimationprogressive % p->txdecimationreplies))
     {
+        uint16_t n = 0;
         eov_mutex_Take(p->mtx_replies, eok_reltimeINFINITE);
+        if(eobool_false == s_eo_transmitter_spill_isneeded(p, eo_transm_spill_replies, p->ropframereplies, s_eo_transmitter_availablebytes(p->ropframereadytotx)))
+        {
+            n = eo_ropframe_ROP_NumberOf(p->ropframereplies);
+            eo_ropframe_Append(p->ropframereadytotx, p->ropframereplies, &remainingbytes);
+        }
+        else
+        {
+            n = s_eo_transmitter_spill_move(p, eo_transm_spill_replies, p->ropframereplies, p->ropframereadytotx, s_eo_transmitter_availablebytes(p->ropframereadytotx));
+        }
         if(NULL != ropsnum)
         {
-            ropsnum->numberofreplies = eo_ropframe_ROP_NumberOf(p->ropframereplies);
+            ropsnum->numberofreplies = n;
         }        
-        eo_ropframe_Append(p->ropframereadytotx, p->ropframereplies, &remainingbytes);
         eo_ropframe_Clear(p->ropframereplies);
         eov_mutex_Release(p->mtx_replies);
     }
@@ -1157,20 +1134,177 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
 }
 
 
-extern eOresult_t eo_transmitter_TXdecimation_Set(EOtransmitter *p, uint8_t repliesTXdecimation, uint8_t regularsTXdecimation, uint8_t occasionalsTXdecimation)
+extern eOresult_t eo_transmitter_outpacket_PrepareSegments(EOtransmitter *p, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum)
 {
+    eOropframe_segment_t *ropsegments = NULL;
+    uint8_t nropsegments = 0;
+    uint16_t nrops = 0;
+    uint16_t n = 0;
+    uint16_t availablebytes = 0;
+
     if(NULL == p) 
     {
         return(eores_NOK_nullpointer);
     }
     
-    if(0 == repliesTXdecimation)
+    if(NULL != ropsnum)
     {
-        repliesTXdecimation = 1;
+        ropsnum->numberofregulars = 0;
+        ropsnum->numberofoccasionals = 0;
+        ropsnum->numberofreplies = 0;       
     }
-    if(0 == regularsTXdecimation)
+    
+    s_eo_transmitter_intransit_init(p);
+    
+    // the ropframe to transmit keeps only the header. the rops segments go between header and footer
+    eo_ropframe_Clear(p->ropframereadytotx);
+    eo_ropframe_EffectiveCapacity_Get(p->ropframereadytotx, &availablebytes);
+    ropsegments = &p->outsegments[1];
+    p->outsegmentsnumberof = 0;
+
+    // the regulars are used in place. keep them afterwards. dont clear them !!!
+    if(0 == (p->txdecimationprogressive % p->txdecimationregulars))
     {
-        regularsTXdecimation = 1;
+        EOropframe* cycledregulars = NULL;
+        uint16_t nregularscycled = 0;
+
+        // refresh all regulars ...    
+        eo_transmitter_regular_rops_Refresh(p);
+        
+        eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
+        
+        // at first the standard regulars which are always transmitted
+        n = s_eo_transmitter_segment_add(p->ropframeregulars_standard, ropsegments, &nropsegments, &availablebytes);
+        
+        // then the cycled one, if there are any
+        cycledregulars = s_eo_transmitter_get_cycled_regropframe(p, &nregularscycled);
+        if(NULL != cycledregulars)
+        {
+            n += s_eo_transmitter_segment_add(cycledregulars, ropsegments, &nropsegments, &availablebytes);
+        }
+        
+        // and the scheduled ones which are due in this tick
+        cycledregulars = s_eo_transmitter_scheduled_collect(p, &nregularscycled);
+        if(NULL != cycledregulars)
+        {
+            n += s_eo_transmitter_segment_add(cycledregulars, ropsegments, &nropsegments, &availablebytes);
+        }
+                
+        eov_mutex_Release(p->mtx_regulars);
+        
+        nrops += n;
+        if(NULL != ropsnum)
+        {
+            ropsnum->numberofregulars = n;
+        }
+        
+        // very important: increment the regulars progressive number. it is used to decide which cycling regular to get
+        p->txregularsprogressive ++;
+    }
+    
+    // move the staged occasionals and replies into their ropframes
+    s_eo_transmitter_staging_drain(p);
+
+    // the occasionals go in transit and the ropframe gets the buffer which was in transit. if they need to be spilled 
+    // (see eo_transmitter_outpacket_Prepare()), what fits is copied in transit instead
+    if((0 == (p->txdecimationprogressive % p->txdecimationoccasionals)) && (NULL != p->ropframeoccasionals_intransit))
+    {
+        eov_mutex_Take(p->mtx_occasionals, eok_reltimeINFINITE);
+        if(eobool_false == s_eo_transmitter_spill_isneeded(p, eo_transm_spill_occasionals, p->ropframeoccasionals, availablebytes))
+        {
+            s_eo_transmitter_intransit_swap(p->ropframeoccasionals, p->ropframeoccasionals_intransit);
+        }
+        else
+        {
+            eo_ropframe_Clear(p->ropframeoccasionals_intransit);
+            s_eo_transmitter_spill_move(p, eo_transm_spill_occasionals, p->ropframeoccasionals, p->ropframeoccasionals_intransit, availablebytes);
+            eo_ropframe_Clear(p->ropframeoccasionals);
+        }
+        eov_mutex_Release(p->mtx_occasionals);
+        
+        n = s_eo_transmitter_segment_add(p->ropframeoccasionals_intransit, ropsegments, &nropsegments, &availablebytes);
+        nrops += n;
+        if(NULL != ropsnum)
+        {
+            ropsnum->numberofoccasionals = n;
+        }
+    }
+
+    // and so do the replies
+    if((0 == (p->txdecimationprogressive % p->txdecimationreplies)) && (NULL != p->ropframereplies_intransit))
+    {
+        eov_mutex_Take(p->mtx_replies, eok_reltimeINFINITE);
+        if(eobool_false == s_eo_transmitter_spill_isneeded(p, eo_transm_spill_replies, p->ropframereplies, availablebytes))
+        {
+            s_eo_transmitter_intransit_swap(p->ropframereplies, p->ropframereplies_intransit);
+        }
+        else
+        {
+            eo_ropframe_Clear(p->ropframereplies_intransit);
+            s_eo_transmitter_spill_move(p, eo_transm_spill_replies, p->ropframereplies, p->ropframereplies_intransit, availablebytes);
+            eo_ropframe_Clear(p->ropframereplies);
+        }
+        eov_mutex_Release(p->mtx_replies);
+        
+        n = s_eo_transmitter_segment_add(p->ropframereplies_intransit, ropsegments, &nropsegments, &availablebytes);
+        nrops += n;
+        if(NULL != ropsnum)
+        {
+            ropsnum->numberofreplies = n;
+        }
+    }
+    
+    // the header describes all the rops of the segments
+    eo_ropframe_HeaderFooter_Adjust(p->ropframereadytotx, ropsegments, nropsegments, nrops, &p->outsegments[0], &p->outsegments[nropsegments+1]);
+    p->outsegmentsnumberof = nropsegments + 2;
+
+    if(NULL != numberofrops)
+    {
+        *numberofrops = nrops;   
+    }
+    
+    // finally we must increment the txdecimationprogressive
+    p->txdecimationprogressive ++;
+    
+    return(eores_OK); 
+}
+
+
+extern eOresult_t eo_transmitter_outpacket_GetSegments(EOtransmitter *p, eOtransmitter_segments_t *segments)
+{
+    if((NULL == p) || (NULL == segments)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(0 == p->outsegmentsnumberof)
+    {   // eo_transmitter_outpacket_PrepareSegments() was not called
+        return(eores_NOK_generic);
+    }
+    
+    // age, sequence number and confirmation requests. the header is in the same memory of the out packet
+    s_eo_transmitter_outpacket_finalise(p);
+
+    s_eo_transmitter_segments_fill(p, segments, p->ipv4addr, p->ipv4port);
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_transmitter_TXdecimation_Set(EOtransmitter *p, uint8_t repliesTXdecimation, uint8_t regularsTXdecimation, uint8_t occasionalsTXdecimation)
+{
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(0 == repliesTXdecimation)
+    {
+        repliesTXdecimation = 1;
+    }
+    if(0 == regularsTXdecimation)
+    {
+        regularsTXdecimation = 1;
     }
     if(0 == occasionalsTXdecimation)
     {
@@ -1191,11 +1325,8 @@ extern eOresult_t eo_transmitter_outpacket_SetRemoteAddress(EOtransmitter *p, eO
     {
         return(eores_NOK_generic);
     }
-    eOipv4addr_t ra = 0;
-    eOipv4port_t rp = 0;
-    eo_packet_Addressing_Get(p->txpacket, &ra, &rp);
-        
-    if((ra != remaddr) || (rp != remport))
+    // we compare versus the main destination and not versus the packet, which a fan-out may have addressed elsewhere
+    if((p->ipv4addr != remaddr) || (p->ipv4port != remport))
     {
         p->ipv4addr = remaddr;
         p->ipv4port = remport;
@@ -1213,15 +1344,13 @@ extern eOresult_t eo_transmitter_outpacket_Get(EOtransmitter *p, EOpacket **outp
     {
         return(eores_NOK_nullpointer);
     }
-
     
-    // now add the age of the frame
-    eo_ropframe_age_Set(p->ropframereadytotx, eov_sys_LifeTimeGet(eov_sys_GetHandle()));
-        
-    // add sequence number
-    p->tx_seqnum++;
-    eo_ropframe_seqnum_Set(p->ropframereadytotx, p->tx_seqnum);
+    if(0 != p->outsegmentsnumberof)
+    {   // in scatter-gather mode the packet is not formed: use eo_transmitter_outpacket_GetSegments()
+        return(eores_NOK_generic);
+    }
 
+    
     // now set the size of the packet according to what is inside the ropframe.
     eo_ropframe_Size_Get(p->ropframereadytotx, &size);
     eo_packet_Size_Set(p->txpacket, size);
@@ -1237,19 +1366,139 @@ extern eOresult_t eo_transmitter_outpacket_Get(EOtransmitter *p, EOpacket **outp
     }
 #endif
     
+    // a previous fan-out may have changed the address of the packet, also if its destination was removed afterwards
+    eo_packet_Addressing_Set(p->txpacket, p->ipv4addr, p->ipv4port);
+    
     // finally gives back the packet
     *outpkt = p->txpacket;
 
+    // age, sequence number and confirmation requests
+    s_eo_transmitter_outpacket_finalise(p);
+        
+    return(eores_OK);   
+}
 
-    // if the confirmation manager is active .. call it
-    if(NULL != p->confmanager)
+extern eOresult_t eo_transmitter_destination_Add(EOtransmitter *p, eOipv4addr_t ipv4addr, eOipv4port_t ipv4port)
+{
+    uint8_t i = 0;
+    
+    if(NULL == p) 
     {
-        eo_confman_ConfirmationRequests_Process(p->confmanager, p->ipv4addr);
+        return(eores_NOK_nullpointer);
     }
-        
-    return(eores_OK);   
+    
+    if((ipv4addr == p->ipv4addr) && (ipv4port == p->ipv4port))
+    {   // it is the main destination
+        return(eores_OK);
+    }
+    
+    for(i=0; i<p->destinationsnumberof; i++)
+    {
+        if((ipv4addr == p->destinations[i].ipv4addr) && (ipv4port == p->destinations[i].ipv4port))
+        {   // it is already inside
+            return(eores_OK);
+        }
+    }
+    
+    if(eo_transmitter_maxnumberofdestinations == p->destinationsnumberof)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    p->destinations[p->destinationsnumberof].ipv4addr = ipv4addr;
+    p->destinations[p->destinationsnumberof].ipv4port = ipv4port;
+    p->destinations[p->destinationsnumberof].seqnum = 0;
+    p->destinationsnumberof ++;
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_transmitter_destination_Remove(EOtransmitter *p, eOipv4addr_t ipv4addr, eOipv4port_t ipv4port)
+{
+    uint8_t i = 0;
+    
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    for(i=0; i<p->destinationsnumberof; i++)
+    {
+        if((ipv4addr == p->destinations[i].ipv4addr) && (ipv4port == p->destinations[i].ipv4port))
+        {   // we keep the others compact and in the same order
+            p->destinationsnumberof --;
+            memmove(&p->destinations[i], &p->destinations[i+1], (p->destinationsnumberof - i) * sizeof(eo_transm_destination_t));
+            return(eores_OK);
+        }
+    }
+    
+    return(eores_NOK_generic);
+}
+
+
+extern uint8_t eo_transmitter_destination_NumberOf(EOtransmitter *p)
+{
+    if(NULL == p) 
+    {
+        return(0);
+    }
+    
+    return(p->destinationsnumberof);
+}
+
+
+extern eOresult_t eo_transmitter_outpacket_GetForDestination(EOtransmitter *p, uint8_t destination, EOpacket **outpkt)
+{
+    eo_transm_destination_t *dest = NULL;
+    
+    if((NULL == p) || (NULL == outpkt)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if((destination >= p->destinationsnumberof) || (0 != p->outsegmentsnumberof))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    // the packet was formed by eo_transmitter_outpacket_Get(): we change only the sequence number and the address 
+    dest = &p->destinations[destination];
+    dest->seqnum ++;
+    eo_ropframe_seqnum_Set(p->ropframereadytotx, dest->seqnum);
+    eo_packet_Addressing_Set(p->txpacket, dest->ipv4addr, dest->ipv4port);
+    
+    *outpkt = p->txpacket;
+    
+    return(eores_OK);
 }
 
+
+extern eOresult_t eo_transmitter_outpacket_GetSegmentsForDestination(EOtransmitter *p, uint8_t destination, eOtransmitter_segments_t *segments)
+{
+    eo_transm_destination_t *dest = NULL;
+    
+    if((NULL == p) || (NULL == segments)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if((destination >= p->destinationsnumberof) || (0 == p->outsegmentsnumberof))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    // the header segment is inside the ropframe ready to tx, thus we write in there the sequence number
+    dest = &p->destinations[destination];
+    dest->seqnum ++;
+    eo_ropframe_seqnum_Set(p->ropframereadytotx, dest->seqnum);
+    
+    s_eo_transmitter_segments_fill(p, segments, dest->ipv4addr, dest->ipv4port);
+    
+    return(eores_OK);
+}
+
+
 extern eOresult_t eo_transmitter_lasterror_Get(EOtransmitter *p, int32_t *err, int32_t *info0, int32_t *info1, int32_t *info2)
 {
 //    eOresult_t res;
@@ -1273,15 +1522,34 @@ extern eOresult_t eo_transmitter_lasterror_Get(EOtransmitter *p, int32_t *err, i
     return(eores_OK);    
 }
 
+extern eOresult_t eo_transmitter_spill_Statistics_Get(EOtransmitter *p, eOtransmitter_spillstatistics_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    eov_mutex_Take(p->mtx_occasionals, eok_reltimeINFINITE);
+    stats->occasionals = p->spill[eo_transm_spill_occasionals].counters;
+    eov_mutex_Release(p->mtx_occasionals);
+    
+    eov_mutex_Take(p->mtx_replies, eok_reltimeINFINITE);
+    stats->replies = p->spill[eo_transm_spill_replies].counters;
+    eov_mutex_Release(p->mtx_replies);
+    
+    return(eores_OK);
+}
+
+
 extern eOresult_t eo_transmitter_occasional_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc)
 {   // we dont care about p->ropframeoccasionals being invalid because all controls are inside s_eo_transmitter_rops_Load().
-    return(s_eo_transmitter_rops_Load(p, ropdesc, p->ropframeoccasionals, p->mtx_occasionals));
+    return(s_eo_transmitter_rops_Load(p, ropdesc, p->ropframeoccasionals, p->mtx_occasionals, eo_transm_stagedrop_occasional));
 }
 
 
 extern eOresult_t eo_transmitter_reply_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc)
 {   // we dont care about p->ropframereplies being invalid because all controls are inside s_eo_transmitter_rops_Load().
-    return(s_eo_transmitter_rops_Load(p, ropdesc, p->ropframereplies, p->mtx_replies));
+    return(s_eo_transmitter_rops_Load(p, ropdesc, p->ropframereplies, p->mtx_replies, eo_transm_stagedrop_reply));
 }
 
 
@@ -1324,40 +1592,6 @@ extern eOresult_t eo_transmitter_occasional_rops_LoadStream(EOtransmitter *p, ui
 // --------------------------------------------------------------------------------------------------------------------
 
 
-static eOresult_t s_eo_transmitter_ropmatchingrule_rule(void *item, void *param)
-{
-    eo_transm_regrop_info_t *inside = (eo_transm_regrop_info_t*)item;
-    eOropdescriptor_t *targetrop = (eOropdescriptor_t*)param;
-
-//    if((inside->thenv.id32 == targetrop->id32) && (inside->ropcode == targetrop->ropcode))
-    if(inside->thenv.id32 == targetrop->id32)
-    {
-        return(eores_OK);
-    }
-    else
-    {
-        return(eores_NOK_generic);
-    }
-}
-
-static eOresult_t s_eo_transmitter_entitymatchingrule_rule(void *item, void *param)
-{
-    eo_transm_regrop_info_t *inside = (eo_transm_regrop_info_t*)item;
-    uint32_t *id32 = (uint32_t*)param;
-
-    uint32_t id32_inside_masked = inside->thenv.id32 & 0xffff0000;
-    uint32_t id32_target_masked = *id32 & 0xffff0000; 
-    if(id32_inside_masked == id32_target_masked)
-    {
-        return(eores_OK);
-    }
-    else
-    {
-        return(eores_NOK_generic);
-    }
-}
-
-
 static void s_eo_transmitter_list_updaterop_in_ropframe(void *item, void *param)
 {
     eo_transm_regrop_info_t *inside = (eo_transm_regrop_info_t*)item;
@@ -1366,6 +1600,18 @@ static void s_eo_transmitter_list_updaterop_in_ropframe(void *item, void *param)
     uint8_t *origofrop;
     uint8_t *dest;
     
+    // if some rops were removed from the ropframe, we at first fix the ropstarthere
+    if(0 != p->regropoffsets[inside->regropframetype].numberofshifts)
+    {
+        inside->ropstarthere = s_eo_transmitter_regropoffsets_effective(p, inside);
+    }
+    
+    // a scheduled rop which is not sent in this tick does not need to be refreshed
+    if(eobool_false == s_eo_transmitter_scheduled_isdue(p, inside))
+    {
+        return;
+    }
+    
     // retrieve the beginning of the ropstream inside the ropframe
     origofrop = eo_ropframe_hid_get_pointer_offset(inside->ropframe, inside->ropstarthere);
     dest = origofrop + sizeof(eOrophead_t);
@@ -1373,10 +1619,11 @@ static void s_eo_transmitter_list_updaterop_in_ropframe(void *item, void *param)
     // if it has a data field ... copy from the nv to the ropstream
     if(eobool_true == inside->hasdata2update)
     {
-        // by using eo_nv_hid_Fast_LocalMemoryGet() we use the protection which is configured
+        // by using eo_nv_hid_Fast_LocalMemoryGetIfDirty() we use the protection which is configured
         // by the EOnvscfg object, and the concurrent access to the netvar is managed
-        // internally the nv object.
-        eo_nv_hid_Fast_LocalMemoryGet(&inside->thenv, dest);
+        // internally the nv object. moreover, if the EOnvSet tracks the writes of its nvs, the copy 
+        // is done only if the nv has changed since last time, as the ropstream still holds the old value.
+        eo_nv_hid_Fast_LocalMemoryGetIfDirty(&inside->thenv, dest);
         
         // with memcpy the copy from local buffer to dest is not protected, thus data format may be corrupt
         // in case any concurrent task is in the process of writing the local buffer.
@@ -1401,24 +1648,407 @@ static void s_eo_transmitter_list_updaterop_in_ropframe(void *item, void *param)
 }
 
 
-static void s_eo_transmitter_list_shiftdownropinfo(void *item, void *param)
+static void s_eo_transmitter_list_fixropstarthere(void *item, void *param)
+{
+    eo_transm_regrop_info_t *inside = (eo_transm_regrop_info_t*)item;
+    EOtransmitter *p = (EOtransmitter*)param;
+    
+    inside->ropstarthere = s_eo_transmitter_regropoffsets_effective(p, inside);
+}
+
+
+static void s_eo_transmitter_regropindex_init(EOtransmitter *p, uint16_t maxnumberofregularrops)
+{
+    uint32_t capacity = 4;
+    
+    p->regropindex.entries = NULL;
+    p->regropindex.capacity = 0;
+    p->regropindex.mask = 0;
+    
+    if(0 == maxnumberofregularrops)
+    {
+        return;
+    }
+    
+    // a load factor of at most 50% keeps the linear probing short. the limit of 65536 entries is always bigger than 
+    // maxnumberofregularrops, thus even a full listofregropinfo leaves at least one empty entry in the index
+    while((capacity < 2*(uint32_t)maxnumberofregularrops) && (capacity < 65536))
+    {
+        capacity <<= 1;
+    }
+    
+    p->regropindex.capacity = capacity;
+    p->regropindex.mask = capacity - 1;
+    p->regropindex.entries = (eo_transm_regrop_indexentry_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(eo_transm_regrop_indexentry_t), capacity);    
+    s_eo_transmitter_regropindex_clear(p);
+}
+
+
+static uint32_t s_eo_transmitter_regropindex_hash(EOtransmitter *p, eOprotID32_t id32)
+{   // multiplicative hashing: it spreads well the index and the tag, which are in the lower bits of the id32
+    return(((uint32_t)(id32 * 2654435761u) >> 16) & p->regropindex.mask);
+}
+
+
+static EOlistIter* s_eo_transmitter_regropindex_find(EOtransmitter *p, eOprotID32_t id32)
+{
+    uint32_t i = 0;
+    uint32_t n = 0;
+    eo_transm_regrop_indexentry_t *entries = p->regropindex.entries;
+    
+    if(NULL == entries)
+    {
+        return(NULL);
+    }
+    
+    // we never probe more than capacity entries, so that we stop also if the index has no empty entry
+    for(i = s_eo_transmitter_regropindex_hash(p, id32); (n < p->regropindex.capacity) && (NULL != entries[i].li); i = (i+1) & p->regropindex.mask, n++)
+    {
+        if(id32 == entries[i].id32)
+        {
+            return(entries[i].li);
+        }
+    }
+    
+    return(NULL);
+}
+
+
+static eOresult_t s_eo_transmitter_regropindex_insert(EOtransmitter *p, eOprotID32_t id32, EOlistIter *li)
+{
+    uint32_t i = 0;
+    uint32_t n = 0;
+    eo_transm_regrop_indexentry_t *entries = p->regropindex.entries;
+    
+    if(NULL == entries)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    // the caller has verified that the id32 is not inside and that the list is not full, thus there should always be
+    // an empty entry. anyway, we never probe more than capacity entries.
+    for(i = s_eo_transmitter_regropindex_hash(p, id32); (n < p->regropindex.capacity) && (NULL != entries[i].li); i = (i+1) & p->regropindex.mask, n++);
+    
+    if(n == p->regropindex.capacity)
+    {   // the index is full
+        return(eores_NOK_busy);
+    }
+    
+    entries[i].id32 = id32;
+    entries[i].li = li;
+    
+    return(eores_OK);
+}
+
+
+static void s_eo_transmitter_regropindex_remove(EOtransmitter *p, eOprotID32_t id32)
+{
+    uint32_t i = 0;
+    uint32_t j = 0;
+    uint32_t h = 0;
+    uint32_t n = 0;
+    eObool_t stays = eobool_false;
+    eo_transm_regrop_indexentry_t *entries = p->regropindex.entries;
+    
+    if(NULL == entries)
+    {
+        return;
+    }
+    
+    for(i = s_eo_transmitter_regropindex_hash(p, id32); (n < p->regropindex.capacity) && (NULL != entries[i].li); i = (i+1) & p->regropindex.mask, n++)
+    {
+        if(id32 == entries[i].id32)
+        {
+            break;
+        }
+    }
+    
+    if((n == p->regropindex.capacity) || (NULL == entries[i].li))
+    {   // not found
+        return;
+    }
+    
+    entries[i].li = NULL;
+    
+    // we dont use tombstones: we move back the following entries of the same cluster which would not be found anymore.
+    // the cluster cannot be longer than capacity-1 entries because entries[i] is now empty.
+    for(j = (i+1) & p->regropindex.mask; NULL != entries[j].li; j = (j+1) & p->regropindex.mask)
+    {
+        h = s_eo_transmitter_regropindex_hash(p, entries[j].id32);
+        // the entry in j stays where it is if its home h is cyclically inside (i, j]
+        stays = (i <= j) ? ((i < h) && (h <= j)) : ((i < h) || (h <= j));
+        if(eobool_false == stays)
+        {
+            entries[i] = entries[j];
+            entries[j].li = NULL;
+            i = j;
+        }
+    }
+}
+
+
+static void s_eo_transmitter_regropindex_clear(EOtransmitter *p)
 {
-    eo_transm_regrop_info_t *after = (eo_transm_regrop_info_t*)item;
-    eo_transm_regrop_info_t *theone2beremoved = (eo_transm_regrop_info_t*)param;
+    if(NULL != p->regropindex.entries)
+    {
+        memset(p->regropindex.entries, 0, sizeof(eo_transm_regrop_indexentry_t)*p->regropindex.capacity);
+    }
+}
+
+
+static void s_eo_transmitter_regropoffsets_reset(EOtransmitter *p)
+{
+    memset(p->regropoffsets, 0, sizeof(p->regropoffsets));
+}
+
+
+static uint16_t s_eo_transmitter_regropoffsets_effective(EOtransmitter *p, const eo_transm_regrop_info_t *info)
+{
+    const eo_transm_regrop_offsettable_t *table = &p->regropoffsets[info->regropframetype];
+    uint16_t pos = info->ropstarthere;
+    uint16_t i = 0;
+    
+    for(i=0; i<table->numberofshifts; i++)
+    {
+        if(table->shifts[i].ropstarthere < info->ropstarthere)
+        {
+            pos -= table->shifts[i].ropsize;
+        }
+    }
+    
+    return(pos);
+}
+
+
+static void s_eo_transmitter_regropoffsets_fix(EOtransmitter *p)
+{
+    eo_list_Execute(p->listofregropinfo, s_eo_transmitter_list_fixropstarthere, p);
+    s_eo_transmitter_regropoffsets_reset(p);
+}
+
+
+static void s_eo_transmitter_regrop_remove(EOtransmitter *p, EOlistIter *li)
+{
+    eo_transm_regrop_info_t *info = (eo_transm_regrop_info_t*) eo_list_At(p->listofregropinfo, li);
+    eo_transm_regropframe_t type = (eo_transm_regropframe_t)info->regropframetype;
+    eo_transm_regrop_offsettable_t *table = &p->regropoffsets[type];
+    EOropframe *ropframe = info->ropframe;
+    uint16_t ropsize = info->ropsize;
+    uint16_t stored = info->ropstarthere;
+    uint16_t effective = s_eo_transmitter_regropoffsets_effective(p, info);
+    uint8_t info_period = info->period;
+    uint8_t info_phase = info->phase;
+    
+    s_eo_transmitter_regropindex_remove(p, info->thenv.id32);
+    
+    // after the erase, info points to zero-ed memory
+    eo_list_Erase_quickversion(p->listofregropinfo, li);
+    
+    // inside the regular ropframe: remove a rop of ropsize which starts at its effective position. it decrements the nrops by 1,
+    // the size by ropsize and makes a memmove down by ropsize of what follows.
+    eo_ropframe_ROP_Rem(ropframe, effective, ropsize);
+    
+    // decrement the size of relevant ropframe
+    s_eo_transmitter_regulars_update_sizes(p, type, info_period, info_phase, -ropsize);
+    
+    // and finally keep the shift in the offset table. if it is full we fix all the ropstarthere: after that the stored
+    // coordinates are the effective ones.
+    if(EOTRANSMITTER_REGROPS_MAXPENDINGSHIFTS == table->numberofshifts)
+    {
+        s_eo_transmitter_regropoffsets_fix(p);
+        stored = effective;
+    }
+    
+    table->shifts[table->numberofshifts].ropstarthere = stored;
+    table->shifts[table->numberofshifts].ropsize = ropsize;
+    table->numberofshifts ++;
+    table->totalshift += ropsize;
+}
+
+
+static eOresult_t s_eo_transmitter_regular_rops_load(EOtransmitter *p, eOropdescriptor_t* ropdesc, uint8_t period)
+{
+    eo_transm_regrop_info_t regropinfo;
+    eOropdescriptor_t ropdescriptor;
+    eOresult_t res;
+    uint16_t usedbytes;
+    uint16_t remainingbytes;
+    uint16_t ropstarthere;
+    uint16_t ropsize;
+    EOnv nv;
+    EOnv* tmpnvptr = NULL;
+    eo_transm_regropframe_t regropframe2use_type = eo_transm_regropframe_standard;
+    EOropframe* regropframe2use = NULL;
+    uint8_t phase = 0;
+
+    if((NULL == p) || (NULL == ropdesc)) 
+    {
+        return(eores_NOK_nullpointer);
+    }  
+
+    if(NULL == p->listofregropinfo)
+    {    // in such a case there is room for regular rops (for instance because the cfg->maxnumberofregularrops is zero)
+        return(eores_NOK_generic);
+    }
+    
+    
+    eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
+
+    // work on the list ...     
+    if(eobool_true == eo_list_Full(p->listofregropinfo))
+    {   // we have reached cfg->maxnumberofregularrops
+        eov_mutex_Release(p->mtx_regulars);
+        return(eores_NOK_generic);
+    }
+    
 
-    // for each element after: modify its content so that ropstarthere is decremented by theone2beremoved.ropsize
-    // but only if they have the same regropframetype
+    // search for the id32 inside the index of listofregropinfo. if found, then ... dont do anything because it means that the rop is already inside
+    if(NULL != s_eo_transmitter_regropindex_find(p, ropdesc->id32))
+    {   // it is already inside ...
+        eov_mutex_Release(p->mtx_regulars);
+        return(eores_OK);
+    }    
+    
+    // else ... prepare a temporary variable eo_transm_regrop_info_t to be put inside the list.
+    // and wait success of rop + insetrtion in frame
+    
+    memcpy(&ropdescriptor, ropdesc, sizeof(eOropdescriptor_t));
+    ropdescriptor.control.rqstconf  = 0;                // VERY IMPORTANT: the regulars cannot ask for confirmation.
+    ropdescriptor.control.confinfo  = eo_ropconf_none;  // VERY IMPORTANT: the regulars cannot be a ack/nack
+    ropdescriptor.control.version   = EOK_ROP_VERSION_0;
+    
+      
+    res = eo_nvset_NV_Get(  (p->nvset),  
+                            ropdescriptor.id32,
+                            &nv
+                            );   
 
-    if(after->ropframe == theone2beremoved->ropframe)
+    // if the nvset does not have the triple (ip, ep, id) then we return an error because we cannot form the rop
+    if(eores_OK != res)
     {
-        after->ropstarthere -= theone2beremoved->ropsize;
+        eov_mutex_Release(p->mtx_regulars);
+        return(eores_NOK_generic);
+    } 
+
+    // force size to be coherent with the nv. the size is always used, even if there is no data to transmit
+    ropdescriptor.size = eo_nv_Size(&nv);    
+    
+    // now we have the nv. we set its value in local ram
+    if(eobool_true == eo_rop_ropcode_has_data(ropdescriptor.ropcode))
+    { 
+        eOnvOwnership_t nvownership = eo_rop_get_ownership(ropdescriptor.ropcode, eo_ropconf_none, eo_rop_dir_outgoing);        
+        if(eo_nv_ownership_local == nvownership)
+        {   // if the nv is local, then take data from nv, thus no need to write the data field of the nv using ropdescriptor.data.
+            ropdescriptor.data = NULL;   // set ropdescriptor.data to NULL to force eo_agent_OutROPfromNV() to get data from EOnv
+        }
+        else
+        {   // if the nv is remote, then the data must be passed inside ropdescriptor.data
+            
+            // so far we dont support that the device regularly sends commands such as set<remotevar, value>. it can send ask<remotevar> however.
+            // marco.accame on Nov 17 2014: it can regularly sends a ask<remotevar>, even if this mechanisms is not used ... and maybe will never be used ...
+            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, "eo_transmitter_regular_rops_Load(): cant load a regular ROP of remote variable w/ payload", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+            
+            eov_mutex_Release(p->mtx_regulars);
+            return(eores_NOK_generic);
+            
+            // however, if we allow a sending of rop<remotevar, value> ... we must have a descriptor.data not NULL
+            //if(NULL == ropdescriptor.data)
+            //{
+            //    eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_transmitter_regular_rops_Load(): cant have NULL ropdes->data if nv is remote", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+            //}          
+        }
+    }
+    else
+    {   // dont need to send data
+        ropdescriptor.data = NULL;
     }
+
+    // lock tmprop
+    eov_mutex_Take(p->mtx_roptmp, eok_reltimeINFINITE);
+    
+    res = eo_agent_OutROPprepare(p->agent, &nv, &ropdescriptor, p->roptmp, &usedbytes);   
+    
+    // if we cannot prepare the rop ... we quit
+    if(eores_OK != res)
+    {
+        eov_mutex_Release(p->mtx_roptmp);
+        eov_mutex_Release(p->mtx_regulars);
+        return(res);
+    }
+    
+
+    // extract the reference to the associated netvar
+    tmpnvptr = eo_rop_GetNV(p->roptmp);
+    
+
+    // choose the relevant regular ropframe. that depends on the id32 of the ropdescriptor or on the period
+    if(1 == period)
+    {
+        regropframe2use = s_eo_transmitter_id32_to_typeofregulars(p, ropdescriptor.id32, &regropframe2use_type);
+    }
+    else
+    {
+        regropframe2use_type = eo_transm_regropframe_scheduled;
+        regropframe2use = s_eo_transmitter_scheduled_init(p);
+        phase = s_eo_transmitter_scheduled_phase(p, period);
+    }
+    
+    // see if we have space for this rop. as we transmit always a standard with one between cycled0of / cycled1of and the 
+    // scheduled of the tick, we need verify with knowledge of regropframe2use_type, period, phase and of usedbytes. 
+    if(eobool_false == s_eo_transmitter_regulars_canadd_rop(p, regropframe2use_type, period, phase, usedbytes))
+    {   // cannot load the rop because we dont have usedbytes anymore
+        eov_mutex_Release(p->mtx_roptmp);
+        eov_mutex_Release(p->mtx_regulars);
+        return(eores_NOK_generic);        
+    }
+           
+    // put the rop inside the relevant regular ropframe         
+    res = eo_ropframe_ROP_Add(regropframe2use, p->roptmp, &ropstarthere, &ropsize, &remainingbytes);
+    // if we cannot add the rop, then we quit ....
+    if(eores_OK != res)
+    {
+        eov_mutex_Release(p->mtx_roptmp);
+        eov_mutex_Release(p->mtx_regulars);
+        return(res);
+    }
+    
+    // i am sure that ropsize is equal to usedbytes, thus i dont verify with an assert ...
+    
+    // 3. prepare a regropinfo variable to be put inside the list    
+    regropinfo.ropcode                  = ropdescriptor.ropcode;    
+    regropinfo.hasdata2update           = eo_rop_datafield_is_present(&(p->roptmp->stream.head)); 
+    regropinfo.regropframetype          = regropframe2use_type;
+    regropinfo.period                   = period;
+    regropinfo.phase                    = phase;
+    regropinfo.ropframe                 = regropframe2use;
+    // the ropstarthere is stored in the coordinates of the offset table of the ropframe (see s_eo_transmitter_regropoffsets_effective())
+    regropinfo.ropstarthere             = ropstarthere + p->regropoffsets[regropframe2use_type].totalshift;
+    regropinfo.ropsize                  = ropsize;
+    regropinfo.timeoffsetinsiderop      = (0 == p->roptmp->stream.head.ctrl.plustime) ? (EOK_uint16dummy) : (ropsize - 8); //if we have time, then it is in teh last 8 bytes
+    memcpy(&regropinfo.thenv, tmpnvptr, sizeof(EOnv));
+
+
+    // push back regropinfo inside the list and keep its iterator inside the index.
+    eo_list_PushBack(p->listofregropinfo, &regropinfo);
+    if(eores_OK != s_eo_transmitter_regropindex_insert(p, regropinfo.thenv.id32, eo_list_Last(p->listofregropinfo)))
+    {   // cannot happen because the index is always bigger than listofregropinfo, but we tell it anyway
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, "eo_transmitter_regular_rops_Load(): the index of regular ROPs is full", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+    }
+    
+    // increment size of the relevant regular ropframe
+    s_eo_transmitter_regulars_update_sizes(p, regropframe2use_type, period, phase, +regropinfo.ropsize); // with a + we increment
+    
+    eov_mutex_Release(p->mtx_roptmp);
+    eov_mutex_Release(p->mtx_regulars);  
+    
+    return(eores_OK);   
 }
 
 
-static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc, EOropframe* intoropframe, EOVmutexDerived* mtx)
+static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc, EOropframe* intoropframe, EOVmutexDerived* mtx, eo_transm_stagedrop_type_t stagedtype)
 {
-    // marco.accame on 23oct14: mtx protects the occasional or replies ropframe. p->mtx_roptmp protects the use of tmprop
+    // marco.accame on 23oct14: mtx protects the occasional or replies ropframe. p->mtx_roptmp protects the use of tmprop.
+    // if the staging is used, neither of them is taken: the rop is formed inside its own slot of the staging ring.
     eOresult_t res;
     uint16_t usedbytes;
     uint16_t ropsize;
@@ -1435,12 +2065,21 @@ static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t
         return(eores_NOK_nullpointer);
     } 
     
-    // marco.accame on 23oct14
-    // must protect the reading of the ropframe. it has happened that boolres is false even for a good ropframe. 
-    // reason is concurrent tx of the packet and call of this function
-    eov_mutex_Take(mtx, eok_reltimeINFINITE);
-    boolres = eo_ropframe_IsValid(intoropframe);
-    eov_mutex_Release(mtx);
+    if(0 != p->staging.capacity)
+    {   // we dont read the ropframe, which is used by the consumer. its capacity stays constant all over the time
+        uint16_t ss = 0;
+        eo_ropframe_EffectiveCapacity_Get(intoropframe, &ss);
+        boolres = (0 == ss) ? (eobool_false) : (eobool_true);
+    }
+    else
+    {
+        // marco.accame on 23oct14
+        // must protect the reading of the ropframe. it has happened that boolres is false even for a good ropframe. 
+        // reason is concurrent tx of the packet and call of this function
+        eov_mutex_Take(mtx, eok_reltimeINFINITE);
+        boolres = eo_ropframe_IsValid(intoropframe);
+        eov_mutex_Release(mtx);
+    }
     
     if(eobool_false == boolres)
     {   // marco.accame: i added it on 15 may 2014 to exit from function if the ropframe does not have any data
@@ -1488,34 +2127,46 @@ static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t
     }
 
 
-    // we begin the use in rw of p->tmprop: take its mutex ... we must avoid that a concurrent thread use it at the same time.
-    eov_mutex_Take(p->mtx_roptmp, eok_reltimeINFINITE);
+    if(0 != p->staging.capacity)
+    {   // the rop is formed inside its own slot of the staging ring: no mutex is taken
+        res = s_eo_transmitter_staging_put(p, &nv, ropdesc, stagedtype);
+        
+        if(eores_OK != res)
+        {
+            p->lasterror = (eores_NOK_busy == res) ? (6) : (4);
+        }
+    }
+    else
+    {
+        // we begin the use in rw of p->tmprop: take its mutex ... we must avoid that a concurrent thread use it at the same time.
+        eov_mutex_Take(p->mtx_roptmp, eok_reltimeINFINITE);
            
-    res = eo_agent_OutROPprepare(p->agent, &nv, ropdesc, p->roptmp, &usedbytes);    
+        res = eo_agent_OutROPprepare(p->agent, &nv, ropdesc, p->roptmp, &usedbytes);    
     
-    if(eores_OK != res)
-    {
-        p->lasterror = 4;
-        eov_mutex_Release(p->mtx_roptmp);
-        return(res);
-    }
+        if(eores_OK != res)
+        {
+            p->lasterror = 4;
+            eov_mutex_Release(p->mtx_roptmp);
+            return(res);
+        }
 
-    // put the rop inside the ropframe: protec ropframe vs concurrent use
-    eov_mutex_Take(mtx, eok_reltimeINFINITE);
-    res = eo_ropframe_ROP_Add(intoropframe, p->roptmp, NULL, &ropsize, &remainingbytes);
-    eov_mutex_Release(mtx);
+        // put the rop inside the ropframe: protec ropframe vs concurrent use
+        eov_mutex_Take(mtx, eok_reltimeINFINITE);
+        res = eo_ropframe_ROP_Add(intoropframe, p->roptmp, NULL, &ropsize, &remainingbytes);
+        eov_mutex_Release(mtx);
     
-    // we dont use p->tmprop anymore: release its mutex
-    eov_mutex_Release(p->mtx_roptmp);
+        // we dont use p->tmprop anymore: release its mutex
+        eov_mutex_Release(p->mtx_roptmp);
     
-    if(eores_OK != res)
-    {
-        uint16_t ss = 0;
-        p->lasterror_info0 = ropsize;
-        p->lasterror_info1 = remainingbytes;
-        eo_ropframe_EffectiveCapacity_Get(intoropframe, &ss); // no need to protect using mutex as we read its capacity which stays constant all over the time
-        p->lasterror_info2  = ss;
-        p->lasterror = 5;
+        if(eores_OK != res)
+        {
+            uint16_t ss = 0;
+            p->lasterror_info0 = ropsize;
+            p->lasterror_info1 = remainingbytes;
+            eo_ropframe_EffectiveCapacity_Get(intoropframe, &ss); // no need to protect using mutex as we read its capacity which stays constant all over the time
+            p->lasterror_info2  = ss;
+            p->lasterror = 5;
+        }
     }
     
     
@@ -1532,6 +2183,255 @@ static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t
     return(res);   
 }
 
+static void s_eo_transmitter_staging_init(EOtransmitter *p, uint16_t maxnumberofstagedrops, uint16_t capacityofrop)
+{
+    p->staging.slots        = NULL;
+    p->staging.capacity     = 0;
+    p->staging.mask         = 0;
+    p->staging.enqueuepos   = 0;
+    p->staging.dequeuepos   = 0;
+    
+#if defined(EO_ATOMIC_AVAILABLE)    
+    uint32_t i = 0;
+    uint32_t capacity = 1;
+    
+    if(0 == maxnumberofstagedrops)
+    {
+        return;
+    }
+    
+    while(capacity < maxnumberofstagedrops)
+    {
+        capacity <<= 1;
+    }
+    
+    p->staging.slots    = (eo_transm_stagedrop_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eo_transm_stagedrop_t), capacity);
+    p->staging.capacity = capacity;
+    p->staging.mask     = capacity - 1;
+    
+    for(i=0; i<capacity; i++)
+    {
+        p->staging.slots[i].sequence    = i;
+        p->staging.slots[i].type        = eo_transm_stagedrop_none;
+        p->staging.slots[i].rop         = eo_rop_New(capacityofrop);
+    }
+#else
+    // without atomic operations we keep on using the mutexes
+    maxnumberofstagedrops = maxnumberofstagedrops;
+    capacityofrop = capacityofrop;
+#endif    
+}
+
+
+static eOresult_t s_eo_transmitter_staging_put(EOtransmitter *p, EOnv *nv, eOropdescriptor_t* ropdesc, eo_transm_stagedrop_type_t type)
+{
+#if defined(EO_ATOMIC_AVAILABLE) 
+    eOresult_t res = eores_NOK_generic;
+    uint16_t usedbytes = 0;
+    eo_transm_stagedrop_t *slot = NULL;
+    uint32_t pos = p->staging.enqueuepos;
+    int32_t diff = 0;
+    
+    // reserve a slot
+    for(;;)
+    {
+        slot = &p->staging.slots[pos & p->staging.mask];
+        diff = (int32_t)(slot->sequence - pos);
+        if(0 == diff)
+        {   // the slot is free: we try to get it before the other producers
+            if(EO_atomic_cas32(&p->staging.enqueuepos, pos, pos+1))
+            {
+                break;
+            }
+        }
+        else if(diff < 0)
+        {   // the consumer has not freed it yet: the ring is full
+            return(eores_NOK_busy);
+        }
+        pos = p->staging.enqueuepos;
+    }
+    
+    // the slot is ours until we publish it. if the rop cannot be formed we publish it anyway, so that the consumer can skip it 
+    res = eo_agent_OutROPprepare(p->agent, nv, ropdesc, slot->rop, &usedbytes);
+    slot->type = (eores_OK == res) ? (type) : (eo_transm_stagedrop_none);
+    
+    EO_atomic_barrier();
+    slot->sequence = pos + 1;
+    
+    return(res);
+#else
+    p = p; nv = nv; ropdesc = ropdesc; type = type;
+    return(eores_NOK_unsupported);
+#endif     
+}
+
+
+static void s_eo_transmitter_staging_drain(EOtransmitter *p)
+{
+#if defined(EO_ATOMIC_AVAILABLE)
+    eOresult_t res = eores_OK;
+    uint16_t ropsize = 0;
+    uint16_t remainingbytes = 0;
+    uint16_t ropsinside = 0;
+    uint32_t pos = 0;
+    eo_transm_stagedrop_t *slot = NULL;
+    EOropframe *ropframe = NULL;
+    EOVmutexDerived *mtx = NULL;
+    
+    if(0 == p->staging.capacity)
+    {
+        return;
+    }
+    
+    for(;;)
+    {
+        pos = p->staging.dequeuepos;
+        slot = &p->staging.slots[pos & p->staging.mask];
+        
+        if((int32_t)(slot->sequence - (pos+1)) < 0)
+        {   // not published yet
+            break;
+        }
+        
+        EO_atomic_barrier();
+        
+        if(eo_transm_stagedrop_none != slot->type)
+        {
+            ropframe = (eo_transm_stagedrop_occasional == slot->type) ? (p->ropframeoccasionals) : (p->ropframereplies);
+            mtx = (eo_transm_stagedrop_occasional == slot->type) ? (p->mtx_occasionals) : (p->mtx_replies);
+            
+            // the mutex is still needed vs eo_transmitter_reply_ropframe_Load() 
+            eov_mutex_Take(mtx, eok_reltimeINFINITE);
+            res = eo_ropframe_ROP_Add(ropframe, slot->rop, NULL, &ropsize, &remainingbytes);
+            ropsinside = eo_ropframe_ROP_NumberOf(ropframe);
+            eov_mutex_Release(mtx);
+            
+            if(eores_OK != res)
+            {
+                if(0 != ropsinside)
+                {   // the ropframe is full: the rop stays staged (and so do the following ones) until the ropframe is transmitted
+                    break;
+                }
+                // the rop does not fit even inside an empty ropframe: we drop it
+                p->lasterror_info0 = ropsize;
+                p->lasterror_info1 = remainingbytes;
+                p->lasterror_info2 = 0;
+                p->lasterror = 5;
+            }
+        }
+        
+        // we free the slot for the producers
+        p->staging.dequeuepos = pos + 1;
+        EO_atomic_barrier();
+        slot->sequence = pos + p->staging.capacity;
+    }
+#else
+    p = p;
+#endif
+}
+
+
+static void s_eo_transmitter_intransit_init(EOtransmitter *p)
+{
+    uint16_t capacity = 0;
+    
+    // the second buffers of occasionals and replies are allocated only if the scatter-gather mode is used
+    if((NULL == p->ropframeoccasionals_intransit) && (NULL != p->bufferropframeoccasionals))
+    {
+        eo_ropframe_EffectiveCapacity_Get(p->ropframeoccasionals, &capacity);
+        capacity += eo_ropframe_sizeforZEROrops;
+        p->bufferropframeoccasionals_intransit = (uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, capacity, 1);
+        p->ropframeoccasionals_intransit = eo_ropframe_New();
+        eo_ropframe_Load(p->ropframeoccasionals_intransit, p->bufferropframeoccasionals_intransit, eo_ropframe_sizeforZEROrops, capacity);
+        eo_ropframe_Clear(p->ropframeoccasionals_intransit);
+    }
+    
+    if((NULL == p->ropframereplies_intransit) && (NULL != p->bufferropframereplies))
+    {
+        eo_ropframe_EffectiveCapacity_Get(p->ropframereplies, &capacity);
+        capacity += eo_ropframe_sizeforZEROrops;
+        p->bufferropframereplies_intransit = (uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, capacity, 1);
+        p->ropframereplies_intransit = eo_ropframe_New();
+        eo_ropframe_Load(p->ropframereplies_intransit, p->bufferropframereplies_intransit, eo_ropframe_sizeforZEROrops, capacity);
+        eo_ropframe_Clear(p->ropframereplies_intransit);
+    }
+}
+
+
+static void s_eo_transmitter_intransit_swap(EOropframe *ropframe, EOropframe *intransit)
+{
+    uint8_t *data = NULL;
+    uint16_t size = 0;
+    uint16_t capacity = 0;
+    uint8_t *sentdata = NULL;
+    uint16_t sentsize = 0;
+    uint16_t sentcapacity = 0;
+    
+    // the content of ropframe goes in transit. the buffer of intransit has already been sent, thus ropframe can reuse it.
+    eo_ropframe_Get(ropframe, &data, &size, &capacity);
+    eo_ropframe_Get(intransit, &sentdata, &sentsize, &sentcapacity);
+    
+    eo_ropframe_Load(intransit, data, size, capacity);
+    eo_ropframe_Load(ropframe, sentdata, eo_ropframe_sizeforZEROrops, sentcapacity);
+    eo_ropframe_Clear(ropframe);
+}
+
+
+static uint16_t s_eo_transmitter_segment_add(EOropframe *ropframe, eOropframe_segment_t *segments, uint8_t *numberofsegments, uint16_t *availablebytes)
+{
+    eOropframe_segment_t segment = {0};
+    
+    if(eores_OK != eo_ropframe_ROPs_Segment(ropframe, &segment))
+    {
+        return(0);
+    }
+    
+    // as in eo_ropframe_Append(): an empty ropframe adds nothing and a ropframe which does not fit is not added 
+    if((0 == segment.size) || (segment.size > *availablebytes))
+    {
+        return(0);
+    }
+    
+    segments[*numberofsegments] = segment;
+    (*numberofsegments) ++;
+    *availablebytes -= segment.size;
+    
+    return(eo_ropframe_ROP_NumberOf(ropframe));
+}
+
+
+static void s_eo_transmitter_outpacket_finalise(EOtransmitter *p)
+{
+    // now add the age of the frame
+    eo_ropframe_age_Set(p->ropframereadytotx, eov_sys_LifeTimeGet(eov_sys_GetHandle()));
+        
+    // add sequence number
+    p->tx_seqnum++;
+    eo_ropframe_seqnum_Set(p->ropframereadytotx, p->tx_seqnum);
+    
+    // if the confirmation manager is active .. call it
+    if(NULL != p->confmanager)
+    {
+        eo_confman_ConfirmationRequests_Process(p->confmanager, p->ipv4addr);
+    }
+}
+
+
+static void s_eo_transmitter_segments_fill(EOtransmitter *p, eOtransmitter_segments_t *segments, eOipv4addr_t ipv4addr, eOipv4port_t ipv4port)
+{
+    uint8_t i = 0;
+    
+    segments->numberofsegments = p->outsegmentsnumberof;
+    segments->size = 0;
+    for(i=0; i<p->outsegmentsnumberof; i++)
+    {
+        segments->segments[i] = p->outsegments[i];
+        segments->size += p->outsegments[i].size;
+    }
+    segments->ipv4addr = ipv4addr;
+    segments->ipv4port = ipv4port;
+}
+
 static EOropframe * s_eo_transmitter_id32_to_typeofregulars(EOtransmitter* p, eOprotID32_t id32, eo_transm_regropframe_t *ropframetype)
 {
     EOropframe* ret = NULL;
@@ -1608,23 +2508,29 @@ static void s_eo_transmitter_regulars_reset_sizes(EOtransmitter *p)
     p->totalsizeofregulars_standard = 0;
     p->totalsizeofregulars_cycle0of = 0;
     p->totalsizeofregulars_cycle1of = 0;
+    p->totalsizeofregulars_scheduled = 0;
+    memset(p->scheduledbytes, 0, sizeof(p->scheduledbytes));
+    memset(p->scheduledrops, 0, sizeof(p->scheduledrops));
     p->maxsizeofregulars = 0;    
 }
 
 static uint16_t s_eo_transmitter_get_maxsizeof_regularsropframe(EOtransmitter *p)
 {
-    return( p->totalsizeofregulars_standard + EO_MAX(p->totalsizeofregulars_cycle0of, p->totalsizeofregulars_cycle1of) );   
+    return( p->totalsizeofregulars_standard + EO_MAX(p->totalsizeofregulars_cycle0of, p->totalsizeofregulars_cycle1of) + s_eo_transmitter_scheduled_maxbytes(p) );   
 }
 
-static eObool_t s_eo_transmitter_regulars_canadd_rop(EOtransmitter *p, eo_transm_regropframe_t type, uint16_t ropbytes)
+static eObool_t s_eo_transmitter_regulars_canadd_rop(EOtransmitter *p, eo_transm_regropframe_t type, uint8_t period, uint8_t phase, uint16_t ropbytes)
 { 
     uint16_t std = 0;
     uint16_t cy0 = 0;
     uint16_t cy1 = 0;
+    uint16_t sch = 0;
+    uint8_t t = 0;
     
     std = p->totalsizeofregulars_standard;
     cy0 = p->totalsizeofregulars_cycle0of;
     cy1 = p->totalsizeofregulars_cycle1of;
+    sch = s_eo_transmitter_scheduled_maxbytes(p);
 
     switch(type)
     {
@@ -1640,9 +2546,16 @@ static eObool_t s_eo_transmitter_regulars_canadd_rop(EOtransmitter *p, eo_transm
         {
             cy1 += ropbytes;
         } break;           
+        case eo_transm_regropframe_scheduled:
+        {   // the rop adds its bytes to the ticks of its phase
+            for(t=phase; t<eo_transmitter_regrops_maxperiod; t+=period)
+            {
+                sch = EO_MAX(sch, p->scheduledbytes[t] + ropbytes);
+            }
+        } break;
     }
 
-    if( (std + EO_MAX(cy0, cy1)) > p->effectivecapacityofregulars)
+    if( (std + EO_MAX(cy0, cy1) + sch) > p->effectivecapacityofregulars)
     {
         return(eobool_false);
     }
@@ -1651,8 +2564,10 @@ static eObool_t s_eo_transmitter_regulars_canadd_rop(EOtransmitter *p, eo_transm
 }
 
 
-static void s_eo_transmitter_regulars_update_sizes(EOtransmitter *p, eo_transm_regropframe_t type, int16_t ropbytes)
+static void s_eo_transmitter_regulars_update_sizes(EOtransmitter *p, eo_transm_regropframe_t type, uint8_t period, uint8_t phase, int16_t ropbytes)
 {
+    uint8_t t = 0;
+    
     switch(type)
     {
         case eo_transm_regropframe_standard:
@@ -1667,11 +2582,340 @@ static void s_eo_transmitter_regulars_update_sizes(EOtransmitter *p, eo_transm_r
         {
             p->totalsizeofregulars_cycle1of += ropbytes;
         } break;           
+        case eo_transm_regropframe_scheduled:
+        {
+            p->totalsizeofregulars_scheduled += ropbytes;
+            for(t=phase; t<eo_transmitter_regrops_maxperiod; t+=period)
+            {
+                p->scheduledbytes[t] += ropbytes;
+                p->scheduledrops[t] = (ropbytes > 0) ? (p->scheduledrops[t] + 1) : (p->scheduledrops[t] - 1);
+            }
+        } break;
     }
     
     p->maxsizeofregulars = s_eo_transmitter_get_maxsizeof_regularsropframe(p);
 }
 
+static EOropframe * s_eo_transmitter_scheduled_init(EOtransmitter *p)
+{
+    uint32_t capacity = 0;
+    
+    if(NULL != p->ropframeregulars_scheduled)
+    {
+        return(p->ropframeregulars_scheduled);
+    }
+    
+    // the scheduled ropframe holds the rops of every phase. in each tick there are at most effectivecapacityofregulars bytes 
+    // which are due, and a period of eo_transmitter_regrops_maxperiod ticks is filled at least half when phases are packed.
+    // see eo_transmitter_regular_rops_LoadWithPeriod() for the limits this gives.
+    capacity = (uint32_t)p->effectivecapacityofregulars * (eo_transmitter_regrops_maxperiod / 2);
+    if(capacity > (0xfff0 - eo_ropframe_sizeforZEROrops))
+    {   // a ropframe cannot be any bigger
+        capacity = 0xfff0 - eo_ropframe_sizeforZEROrops;
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eo_transmitter_regular_rops_LoadWithPeriod(): the ropframe of scheduled regulars is clamped to 64KB", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    }
+    capacity += eo_ropframe_sizeforZEROrops;
+    
+    p->bufferropframeregulars_scheduled     = (uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, capacity, 1);
+    p->ropframeregulars_scheduled           = eo_ropframe_New();
+    eo_ropframe_Load(p->ropframeregulars_scheduled, p->bufferropframeregulars_scheduled, eo_ropframe_sizeforZEROrops, capacity);
+    eo_ropframe_Clear(p->ropframeregulars_scheduled);
+    
+    // the tx ropframe holds only the rops which are due in a tick 
+    capacity = p->effectivecapacityofregulars + eo_ropframe_sizeforZEROrops;
+    p->bufferropframeregulars_scheduledtx   = (uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, capacity, 1);
+    p->ropframeregulars_scheduledtx         = eo_ropframe_New();
+    eo_ropframe_Load(p->ropframeregulars_scheduledtx, p->bufferropframeregulars_scheduledtx, eo_ropframe_sizeforZEROrops, capacity);
+    eo_ropframe_Clear(p->ropframeregulars_scheduledtx);
+    
+    return(p->ropframeregulars_scheduled);
+}
+
+static uint8_t s_eo_transmitter_scheduled_phase(EOtransmitter *p, uint8_t period)
+{   // we choose the phase whose ticks have the lowest peak of scheduled bytes, so that the bytes per packet stay flat
+    uint8_t phase = 0;
+    uint8_t ph = 0;
+    uint8_t t = 0;
+    uint16_t peak = 0;
+    uint16_t bestpeak = 0xffff;
+    
+    for(ph=0; ph<period; ph++)
+    {
+        peak = 0;
+        for(t=ph; t<eo_transmitter_regrops_maxperiod; t+=period)
+        {
+            peak = EO_MAX(peak, p->scheduledbytes[t]);
+        }
+        if(peak < bestpeak)
+        {
+            bestpeak = peak;
+            phase = ph;
+        }
+    }
+    
+    return(phase);
+}
+
+static uint16_t s_eo_transmitter_scheduled_maxbytes(EOtransmitter *p)
+{
+    uint16_t maxbytes = 0;
+    uint8_t t = 0;
+    
+    for(t=0; t<eo_transmitter_regrops_maxperiod; t++)
+    {
+        maxbytes = EO_MAX(maxbytes, p->scheduledbytes[t]);
+    }
+    
+    return(maxbytes);
+}
+
+static eObool_t s_eo_transmitter_scheduled_isdue(EOtransmitter *p, const eo_transm_regrop_info_t *info)
+{
+    if(eo_transm_regropframe_scheduled != info->regropframetype)
+    {
+        return(eobool_true);
+    }
+    
+    // eo_transmitter_regrops_maxperiod is a multiple of every period, thus we can wrap txregularsprogressive 
+    return(((p->txregularsprogressive % eo_transmitter_regrops_maxperiod) % info->period) == info->phase ? eobool_true : eobool_false);
+}
+
+static EOropframe * s_eo_transmitter_scheduled_collect(EOtransmitter *p, uint16_t *ropsinside)
+{
+    EOlistIter *li = NULL;
+    eo_transm_regrop_info_t *info = NULL;
+    uint8_t *rop = NULL;
+    uint16_t remainingbytes = 0;
+    
+    *ropsinside = 0;
+    
+    if((NULL == p->ropframeregulars_scheduled) || (0 == p->scheduledrops[p->txregularsprogressive % eo_transmitter_regrops_maxperiod]))
+    {
+        return(NULL);
+    }
+    
+    eo_ropframe_Clear(p->ropframeregulars_scheduledtx);
+    
+    for(li = eo_list_Begin(p->listofregropinfo); NULL != li; li = eo_list_Next(p->listofregropinfo, li))
+    {
+        info = (eo_transm_regrop_info_t*) eo_list_At(p->listofregropinfo, li);
+        if((eo_transm_regropframe_scheduled == info->regropframetype) && (eobool_true == s_eo_transmitter_scheduled_isdue(p, info)))
+        {
+            rop = eo_ropframe_hid_get_pointer_offset(info->ropframe, s_eo_transmitter_regropoffsets_effective(p, info));
+            eo_ropframe_ROPdata_Add(p->ropframeregulars_scheduledtx, rop, info->ropsize, &remainingbytes);
+            (*ropsinside) ++;
+        }
+    }
+    
+    return((0 == *ropsinside) ? (NULL) : (p->ropframeregulars_scheduledtx));
+}
+
+
+static uint16_t s_eo_transmitter_availablebytes(EOropframe *ropframe)
+{
+    eOropframe_segment_t segment = {0};
+    uint16_t capacity = 0;
+    
+    eo_ropframe_EffectiveCapacity_Get(ropframe, &capacity);
+    eo_ropframe_ROPs_Segment(ropframe, &segment);
+    
+    return((capacity > segment.size) ? (capacity - segment.size) : (0));
+}
+
+static eObool_t s_eo_transmitter_spill_isneeded(EOtransmitter *p, eo_transm_spillclass_t cl, EOropframe *ropframe, uint16_t availablebytes)
+{
+    eOropframe_segment_t segment = {0};
+    
+    if(0 != s_eo_transmitter_spill_numberof(p, cl))
+    {   // the spilled rops must go first
+        return(eobool_true);
+    }
+    
+    if(eores_OK != eo_ropframe_ROPs_Segment(ropframe, &segment))
+    {
+        return(eobool_false);
+    }
+    
+    return((segment.size > availablebytes) ? (eobool_true) : (eobool_false));
+}
+
+static uint16_t s_eo_transmitter_spill_numberof(EOtransmitter *p, eo_transm_spillclass_t cl)
+{
+    return((NULL == p->spill[cl].ropframe) ? (0) : (eo_ropframe_ROP_NumberOf(p->spill[cl].ropframe)));
+}
+
+static void s_eo_transmitter_spill_init(EOtransmitter *p, eo_transm_spillclass_t cl, EOropframe *ropframe)
+{
+    eo_transm_spill_t *spill = &p->spill[cl];
+    uint16_t capacity = 0;
+    
+    if(NULL != spill->ropframe)
+    {
+        return;
+    }
+    
+    // the spill queue is allocated at the first overflow and it is as big as the ropframe of its class
+    eo_ropframe_EffectiveCapacity_Get(ropframe, &capacity);
+    capacity += eo_ropframe_sizeforZEROrops;
+    
+    spill->buffer       = (uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, capacity, 1);
+    spill->buffertmp    = (uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, capacity, 1);
+    spill->ropframe     = eo_ropframe_New();
+    spill->ropframetmp  = eo_ropframe_New();
+    eo_ropframe_Load(spill->ropframe, spill->buffer, eo_ropframe_sizeforZEROrops, capacity);
+    eo_ropframe_Clear(spill->ropframe);
+    eo_ropframe_Load(spill->ropframetmp, spill->buffertmp, eo_ropframe_sizeforZEROrops, capacity);
+    eo_ropframe_Clear(spill->ropframetmp);
+}
+
+static eObool_t s_eo_transmitter_spill_ishighpriority(const eOrophead_t *head)
+{   
+    // the rops which request a confirmation would otherwise be lost without a nak, and the eOmn_info carry the diagnostics
+    if(1 == head->ctrl.rqstconf)
+    {
+        return(eobool_true);
+    }
+    
+    if((eoprot_endpoint_management == eoprot_ID2endpoint(head->id32)) && (eoprot_entity_mn_info == eoprot_ID2entity(head->id32)))
+    {
+        return(eobool_true);
+    }
+    
+    return(eobool_false);
+}
+
+static eObool_t s_eo_transmitter_spill_contains(const uint8_t *data, uint16_t size, eOprotID32_t id32)
+{   // tells if the stream of rops in [data, data+size) has a rop of id32
+    const eOrophead_t *head = NULL;
+    uint16_t pos = 0;
+    uint16_t ropsize = 0;
+    
+    for(pos=0; pos<size; pos+=ropsize)
+    {
+        head = (const eOrophead_t*) (data + pos);
+        if(id32 == head->id32)
+        {
+            return(eobool_true);
+        }
+        ropsize = eo_rop_compute_size(head->ctrl, (eOropcode_t)head->ropc, head->dsiz);
+        if(0 == ropsize)
+        {
+            break;
+        }
+    }
+    
+    return(eobool_false);
+}
+
+static uint16_t s_eo_transmitter_spill_move(EOtransmitter *p, eo_transm_spillclass_t cl, EOropframe *ropframe, EOropframe *dest, uint16_t availablebytes)
+{
+    eo_transm_spill_t *spill = NULL;
+    EOropframe *sources[2] = {NULL, NULL};
+    EOropframe *tmpropframe = NULL;
+    uint8_t *tmpbuffer = NULL;
+    eOropframe_segment_t segment = {0};
+    eOropframe_segment_t older = {0};
+    eOropframe_segment_t deferred = {0};
+    const eOrophead_t *head = NULL;
+    eObool_t highpriority = eobool_true;
+    eObool_t promoted = eobool_false;
+    uint16_t pos = 0;
+    uint16_t ropsize = 0;
+    uint16_t moved = 0;
+    uint8_t pass = 0;
+    uint8_t s = 0;
+    
+    s_eo_transmitter_spill_init(p, cl, ropframe);
+    spill = &p->spill[cl];
+    
+    eo_ropframe_Clear(spill->ropframetmp);
+    
+    // the spilled rops come before the new ones. at first we move the rops with high priority and then the others.
+    // however, the order of the rops of the same id32 is always kept (a set<> must never overtake a previous set<>), thus: 
+    // - a rop with high priority is promoted to the first pass only if no older rop of the same id32 is queued before it.
+    // - after a rop has been deferred to the spill queue, the following rops of its id32 are deferred as well because 
+    //   the spill queue is transmitted after dest.
+    sources[0] = spill->ropframe;
+    sources[1] = ropframe;
+    
+    for(pass=0; pass<2; pass++)
+    {
+        highpriority = (0 == pass) ? (eobool_true) : (eobool_false);
+        
+        for(s=0; s<2; s++)
+        {
+            if(eores_OK != eo_ropframe_ROPs_Segment(sources[s], &segment))
+            {
+                continue;
+            }
+            
+            for(pos=0; pos<segment.size; pos+=ropsize)
+            {
+                head = (const eOrophead_t*) (segment.data + pos);
+                ropsize = eo_rop_compute_size(head->ctrl, (eOropcode_t)head->ropc, head->dsiz);
+                if(0 == ropsize)
+                {   // the ropstream is not valid, thus we cannot go on
+                    break;
+                }
+                
+                promoted = s_eo_transmitter_spill_ishighpriority(head);
+                if(eobool_true == promoted)
+                {   // look for an older rop of the same id32 inside the sources
+                    if((1 == s) && (eores_OK == eo_ropframe_ROPs_Segment(sources[0], &older)) && (eobool_true == s_eo_transmitter_spill_contains(older.data, older.size, head->id32)))
+                    {
+                        promoted = eobool_false;
+                    }
+                    else if(eobool_true == s_eo_transmitter_spill_contains(segment.data, pos, head->id32))
+                    {
+                        promoted = eobool_false;
+                    }
+                }
+                
+                if(highpriority != promoted)
+                {
+                    continue;
+                }
+                
+                if((eores_OK == eo_ropframe_ROPs_Segment(spill->ropframetmp, &deferred)) && (eobool_true == s_eo_transmitter_spill_contains(deferred.data, deferred.size, head->id32)))
+                {   // an older rop of the same id32 is already deferred: this one cannot go before it
+                    if(eores_OK == eo_ropframe_ROPdata_Add(spill->ropframetmp, (uint8_t*)head, ropsize, NULL))
+                    {
+                        spill->counters.deferred ++;
+                    }
+                    else
+                    {
+                        spill->counters.dropped ++;
+                    }
+                }
+                else if((ropsize <= availablebytes) && (eores_OK == eo_ropframe_ROPdata_Add(dest, (uint8_t*)head, ropsize, NULL)))
+                {
+                    availablebytes -= ropsize;
+                    moved ++;
+                }
+                else if(eores_OK == eo_ropframe_ROPdata_Add(spill->ropframetmp, (uint8_t*)head, ropsize, NULL))
+                {
+                    spill->counters.deferred ++;
+                }
+                else
+                {
+                    spill->counters.dropped ++;
+                }
+            }
+        }
+    }
+    
+    // what was spilled now becomes the spill queue
+    tmpropframe         = spill->ropframe;
+    spill->ropframe     = spill->ropframetmp;
+    spill->ropframetmp  = tmpropframe;
+    tmpbuffer           = spill->buffer;
+    spill->buffer       = spill->buffertmp;
+    spill->buffertmp    = tmpbuffer;
+    
+    return(moved);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
 // --------------------------------------------------------------------------------------------------------------------
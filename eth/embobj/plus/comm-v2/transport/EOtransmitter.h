@@ -78,10 +78,11 @@ typedef struct
 {
     uint16_t        capacityoftxpacket; 
     uint16_t        capacityofrop;    
-    uint16_t        capacityofropframeregulars; 
+    uint16_t        capacityofropframeregulars; // it also sizes the buffer of the rops with period > 1. see eo_transmitter_regular_rops_LoadWithPeriod()
     uint16_t        capacityofropframeoccasionals;
     uint16_t        capacityofropframereplies;
     uint16_t        maxnumberofregularrops;
+    uint16_t        maxnumberofstagedrops;  // if not zero, occasionals and replies are staged lock-free. see eo_transmitter_occasional_rops_Load()
 } eOtransmitter_sizes_t; 
 
 
@@ -101,6 +102,39 @@ typedef struct
     uint8_t     numberofregulars;
     uint8_t     numberofreplies;    
 } eOtransmitter_ropsnumber_t;
+
+
+// the max number of segments of the out packet in scatter-gather mode: header, standard regulars, cycled regulars, 
+// scheduled regulars, occasionals, replies, footer
+enum { eo_transmitter_maxnumberofsegments = 7 };
+
+// the max period (in ticks of the regulars) of a regular rop loaded with eo_transmitter_regular_rops_LoadWithPeriod(). 
+// it must be a power of two.
+enum { eo_transmitter_regrops_maxperiod = 8 };
+
+typedef struct
+{
+    eOropframe_segment_t    segments[eo_transmitter_maxnumberofsegments];
+    uint8_t                 numberofsegments;
+    uint16_t                size;           // the sum of the sizes of the segments
+    eOipv4addr_t            ipv4addr;
+    eOipv4port_t            ipv4port;
+} eOtransmitter_segments_t;
+
+// the max number of further destinations of the out packet in fan-out mode. see eo_transmitter_destination_Add()
+enum { eo_transmitter_maxnumberofdestinations = 4 };
+
+typedef struct
+{
+    uint32_t    deferred;   // rops which did not fit inside the out packet and were kept for the next one (counted at every packet)
+    uint32_t    dropped;    // rops which did not fit inside the out packet nor in the spill queue
+} eOtransmitter_spillcounters_t;
+
+typedef struct
+{
+    eOtransmitter_spillcounters_t   occasionals;
+    eOtransmitter_spillcounters_t   replies;
+} eOtransmitter_spillstatistics_t;
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -139,6 +173,22 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
 
 extern eOresult_t eo_transmitter_outpacket_SetRemoteAddress(EOtransmitter *p, eOipv4addr_t remaddr, eOipv4port_t remport);
 
+/** @fn         extern eOresult_t eo_transmitter_outpacket_PrepareSegments(EOtransmitter *p, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum)
+    @brief      it is the scatter-gather version of eo_transmitter_outpacket_Prepare(): the rops are not copied into the out packet 
+                but are described by a list of segments which point inside the ropframes of the transmitter. the list is
+                retrieved with eo_transmitter_outpacket_GetSegments() and can be sent with a gather function (e.g., sendmsg()).
+                the segments stay valid until the next call of eo_transmitter_outpacket_PrepareSegments() or eo_transmitter_outpacket_Prepare(),
+                as long as no regular rop is loaded or unloaded in the meantime. the occasionals and the replies are double buffered, 
+                thus they can be loaded while the segments are being transmitted.
+    @param      p               pointer to transmitter        
+    @param      numberofrops    contains number of rops in out packet
+    @param      ropsnum         if not NULL contains the number of rops of each kind
+    @return     eores_OK or eores_NOK_nullpointer
+ **/
+extern eOresult_t eo_transmitter_outpacket_PrepareSegments(EOtransmitter *p, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum);
+
+extern eOresult_t eo_transmitter_outpacket_GetSegments(EOtransmitter *p, eOtransmitter_segments_t *segments);
+
 
 /** @fn         extern eOresult_t eo_transmitter_outpacket_Get(EOtransmitter *p, EOpacket **outpkt)
     @brief      returns a pointer to the out packet. it is well formed only if eo_transmitter_outpacket_Prepare() 
@@ -150,6 +200,23 @@ extern eOresult_t eo_transmitter_outpacket_SetRemoteAddress(EOtransmitter *p, eO
 extern eOresult_t eo_transmitter_outpacket_Get(EOtransmitter *p, EOpacket **outpkt);
 
 
+// fan-out mode: besides the destination of the cfg (or of eo_transmitter_outpacket_SetRemoteAddress()) the out packet can be sent 
+// to up to eo_transmitter_maxnumberofdestinations further destinations (unicast or multicast groups). the packet is formed only 
+// once and each destination has its own sequence number. after eo_transmitter_outpacket_Get() (or _GetSegments()) the same buffer 
+// is retrieved for destination i in [0, eo_transmitter_destination_NumberOf()) with eo_transmitter_outpacket_GetForDestination() 
+// (or _GetSegmentsForDestination()), which writes its sequence number and address into it. hence a packet must be sent before 
+// the retrieval for the next destination. the confirmation requests are processed only for the main destination.
+extern eOresult_t eo_transmitter_destination_Add(EOtransmitter *p, eOipv4addr_t ipv4addr, eOipv4port_t ipv4port);
+
+extern eOresult_t eo_transmitter_destination_Remove(EOtransmitter *p, eOipv4addr_t ipv4addr, eOipv4port_t ipv4port);
+
+extern uint8_t eo_transmitter_destination_NumberOf(EOtransmitter *p);
+
+extern eOresult_t eo_transmitter_outpacket_GetForDestination(EOtransmitter *p, uint8_t destination, EOpacket **outpkt);
+
+extern eOresult_t eo_transmitter_outpacket_GetSegmentsForDestination(EOtransmitter *p, uint8_t destination, eOtransmitter_segments_t *segments);
+
+
 extern eOresult_t eo_transmitter_TXdecimation_Set(EOtransmitter *p, uint8_t repliesTXdecimation, uint8_t regularsTXdecimation, uint8_t occasionalsTXdecimation);
 
 // the rops in regular_rops stay forever unless unloaded one by one or all cleared. at each eo_transmitter_outpacket_Prepare() they are placed 
@@ -159,6 +226,15 @@ extern eOsizecntnr_t eo_transmitter_regular_rops_Size_with_ep(EOtransmitter *p,
 extern eOresult_t eo_transmitter_regular_rops_arrayid32_Get(EOtransmitter *p, uint16_t start, EOarray* array);
 extern eOresult_t eo_transmitter_regular_rops_arrayid32_ep_Get(EOtransmitter *p, eOnvEP8_t ep, uint16_t start, EOarray* array);
 extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc); 
+
+// it loads a regular rop which is transmitted only once every period ticks of the regulars. period can be 1, 2, 4, ..., up to 
+// eo_transmitter_regrops_maxperiod, where 1 is the same as eo_transmitter_regular_rops_Load(). the phase of the rop is chosen 
+// so that the bytes of the regulars stay as flat as possible across the ticks, and the load fails if in any tick they would 
+// not fit inside capacityofropframeregulars. the rops with period > 1 also share a buffer of (eo_transmitter_regrops_maxperiod / 2) 
+// times the effective capacity of the regulars (capacityofropframeregulars without the ropframe header and footer), clamped 
+// to 64KB with a warning of the error manager: the load also fails if their total size would exceed it. 
+// if the rop is already loaded, its period is not changed.
+extern eOresult_t eo_transmitter_regular_rops_LoadWithPeriod(EOtransmitter *p, eOropdescriptor_t* ropdesc, uint8_t period); 
 extern eOresult_t eo_transmitter_regular_rops_Unload(EOtransmitter *p, eOropdescriptor_t* ropdesc); 
 extern eOresult_t eo_transmitter_regular_rops_entity_Unload(EOtransmitter *p, eOnvEP8_t ep8, eOnvENT_t ent);
 extern eOresult_t eo_transmitter_regular_rops_Clear(EOtransmitter *p); 
@@ -169,6 +245,16 @@ extern eOresult_t eo_transmitter_regular_rops_Refresh(EOtransmitter *p);
 
 extern eOresult_t eo_transmitter_lasterror_Get(EOtransmitter *p, int32_t *err, int32_t *info0, int32_t *info1, int32_t *info2);
 
+// when the occasionals or the replies dont fit inside the out packet, their rops are moved one by one: what fits goes inside
+// the packet and the rest goes inside a bounded spill queue (as big as their ropframe) which is emptied first at the next 
+// packet. the rops which request a confirmation and the eOmn_info diagnostics go first, unless an older rop of the same id32 
+// is still queued: the rops of the same id32 always keep their order. this function gives the counters.
+extern eOresult_t eo_transmitter_spill_Statistics_Get(EOtransmitter *p, eOtransmitter_spillstatistics_t *stats);
+
+// if sizes.maxnumberofstagedrops is not zero (and the platform has EO_ATOMIC_AVAILABLE), eo_transmitter_occasional_rops_Load() 
+// and eo_transmitter_reply_rops_Load() dont take any mutex: the rop is formed inside a slot of a lock-free staging ring and 
+// is moved into its ropframe by eo_transmitter_outpacket_Prepare() or eo_transmitter_NumberofOutROPs(), which must then be
+// called by the same thread. they return eores_NOK_busy if the ring is full.
 extern eOresult_t eo_transmitter_occasional_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc);
 extern eOresult_t eo_transmitter_occasional_rops_LoadStream(EOtransmitter *p, uint8_t *stream, uint16_t size);
 
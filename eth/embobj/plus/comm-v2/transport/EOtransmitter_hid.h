@@ -54,26 +54,127 @@ extern "C" {
 
 #define USE_DEBUG_EOTRANSMITTER 
 
+// the max number of removals of regular rops which can be kept pending inside the offset table of a regular ropframe 
+// before the ropstarthere of the remaining rops is fixed. the fix is done in any case at the next refresh.
+#define EOTRANSMITTER_REGROPS_MAXPENDINGSHIFTS      8
+
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
 typedef enum
 {
     eo_transm_regropframe_standard  = 0,
     eo_transm_regropframe_cycle0of  = 1,
-    eo_transm_regropframe_cycle1of  = 2
+    eo_transm_regropframe_cycle1of  = 2,
+    eo_transm_regropframe_scheduled = 3     // the rops loaded with a period > 1: they are sent only in the ticks of their phase 
 } eo_transm_regropframe_t;
 
-typedef struct      // 40 bytes on arm .... but not 40 on a 64-bit architecture because of the pointer
+typedef struct      // 44 bytes on arm .... but not 44 on a 64-bit architecture because of the pointer
 {
     eOropcode_t     ropcode;
     uint8_t         hasdata2update  : 1;    // use eobool_true / eobool_false
     uint8_t         regropframetype : 7;    // use values from eo_transm_regropframe_t         
+    uint8_t         period;                 // the rop is sent every period ticks of the regulars. it is > 1 only for eo_transm_regropframe_scheduled
+    uint8_t         phase;                  // ... in the ticks t for which (t % period) == phase
     uint16_t        ropstarthere;           // the index where the rop starts inside teh ropframe. if data is available, then it is placed at ropstarthere+8
     uint16_t        ropsize;
     uint16_t        timeoffsetinsiderop;    // if time is not present its value is 0xffff 
     EOnv            thenv;
     EOropframe*     ropframe;
-} eo_transm_regrop_info_t;   //EO_VERIFYsizeof(eo_transm_regrop_info_t, (8+28+4))
+} eo_transm_regrop_info_t;   //EO_VERIFYsizeof(eo_transm_regrop_info_t, (12+28+4))
+
+
+typedef struct
+{
+    eOprotID32_t    id32;
+    EOlistIter*     li;                     // it is NULL if the entry is empty
+} eo_transm_regrop_indexentry_t;
+
+
+// the index of the regular rops: an open addressing hash table keyed by id32 with linear probing which gives the
+// iterator inside listofregropinfo. its capacity is a power of two, at least twice the maxnumberofregularrops but 
+// at most 65536, which is still bigger than any uint16_t maxnumberofregularrops so that an empty entry always exists.
+typedef struct
+{
+    eo_transm_regrop_indexentry_t*  entries;
+    uint32_t                        capacity;
+    uint32_t                        mask;
+} eo_transm_regrop_index_t;
+
+
+typedef struct
+{
+    uint16_t        ropstarthere;           // the ropstarthere of the removed rop, expressed in the same coordinates of the stored ones
+    uint16_t        ropsize;
+} eo_transm_regrop_shift_t;
+
+
+// the offset table of a regular ropframe. when a rop is removed we dont decrement the ropstarthere of all the rops which 
+// follow it but we keep the removal in here. the effective position of a rop is its ropstarthere minus the size of every 
+// removed rop which was before it. the stored values are fixed (and the table emptied) at the next refresh.
+typedef struct
+{
+    uint16_t                    numberofshifts;
+    uint16_t                    totalshift;
+    eo_transm_regrop_shift_t    shifts[EOTRANSMITTER_REGROPS_MAXPENDINGSHIFTS];
+} eo_transm_regrop_offsettable_t;
+
+
+typedef enum
+{
+    eo_transm_stagedrop_none        = 0,    // the slot was reserved but the rop could not be formed: the consumer skips it
+    eo_transm_stagedrop_occasional  = 1,
+    eo_transm_stagedrop_reply       = 2
+} eo_transm_stagedrop_type_t;
+
+
+typedef struct
+{
+    volatile uint32_t   sequence;           // equal to the position when the slot is free for a producer, to position+1 when it is ready for the consumer
+    uint8_t             type;               // use values from eo_transm_stagedrop_type_t
+    EOrop*              rop;
+} eo_transm_stagedrop_t;
+
+
+// the staging ring of the occasional and reply rops: a bounded multi-producer single-consumer queue. a producer reserves 
+// a slot with a cas on enqueuepos, forms its rop inside the slot and then publishes it by writing its sequence. the 
+// consumer (eo_transmitter_outpacket_Prepare() and eo_transmitter_NumberofOutROPs()) moves the ready rops into their 
+// ropframes. its capacity is a power of two or zero if staging is not used.
+typedef struct
+{
+    eo_transm_stagedrop_t*  slots;
+    uint32_t                capacity;
+    uint32_t                mask;
+    volatile uint32_t       enqueuepos;
+    uint32_t                dequeuepos;
+} eo_transm_staging_t;
+
+
+typedef enum
+{
+    eo_transm_spill_occasionals     = 0,
+    eo_transm_spill_replies         = 1
+} eo_transm_spillclass_t;
+
+
+// the spill queue of a class of rops (occasionals or replies). it keeps the rops which did not fit inside the out packet
+// so that they go out with the next one. its ropframes are created at the first overflow with the capacity of the ropframe
+// of the class. ropframetmp is used to rebuild ropframe and then the two are swapped.
+typedef struct
+{
+    EOropframe*                     ropframe;
+    EOropframe*                     ropframetmp;
+    uint8_t*                        buffer;
+    uint8_t*                        buffertmp;
+    eOtransmitter_spillcounters_t   counters;
+} eo_transm_spill_t;
+
+
+typedef struct
+{
+    eOipv4addr_t                    ipv4addr;
+    eOipv4port_t                    ipv4port;
+    uint64_t                        seqnum;
+} eo_transm_destination_t;
 
 
 typedef struct
@@ -95,8 +196,12 @@ struct EOtransmitter_hid
     EOropframe*                 ropframeregulars_standard;
     EOropframe*                 ropframeregulars_cycle0of;  
     EOropframe*                 ropframeregulars_cycle1of;  
+    EOropframe*                 ropframeregulars_scheduled;     // it holds all the scheduled rops. it is created at the first load with period > 1
+    EOropframe*                 ropframeregulars_scheduledtx;   // it collects the scheduled rops due in the current tick
     EOropframe*                 ropframeoccasionals;    
     EOropframe*                 ropframereplies;
+    EOropframe*                 ropframeoccasionals_intransit;  // used only in scatter-gather mode: what was sent in the last out packet
+    EOropframe*                 ropframereplies_intransit;      // used only in scatter-gather mode: what was sent in the last out packet
     EOrop*                      roptmp;
     EOagent*                    agent;
     EOnvSet*                    nvset;
@@ -106,15 +211,27 @@ struct EOtransmitter_hid
     uint8_t*                    bufferropframeregulars_standard;
     uint8_t*                    bufferropframeregulars_cycle0of;
     uint8_t*                    bufferropframeregulars_cycle1of;
+    uint8_t*                    bufferropframeregulars_scheduled;
+    uint8_t*                    bufferropframeregulars_scheduledtx;
     uint8_t*                    bufferropframeoccasionals;
     uint8_t*                    bufferropframereplies;
+    uint8_t*                    bufferropframeoccasionals_intransit;
+    uint8_t*                    bufferropframereplies_intransit;
     EOlist*                     listofregropinfo; 
+    eo_transm_regrop_index_t    regropindex;
+    eo_transm_regrop_offsettable_t regropoffsets[4];    // one for each value of eo_transm_regropframe_t
+    eo_transm_staging_t         staging;
+    eo_transm_spill_t           spill[2];           // one for each value of eo_transm_spillclass_t
+    eOropframe_segment_t        outsegments[eo_transmitter_maxnumberofsegments];
+    uint8_t                     outsegmentsnumberof;
     eOabstime_t                 currenttime;   
     EOVmutexDerived*            mtx_replies;
     EOVmutexDerived*            mtx_regulars;
     EOVmutexDerived*            mtx_occasionals;
     EOVmutexDerived*            mtx_roptmp;
     uint64_t                    tx_seqnum;
+    eo_transm_destination_t     destinations[eo_transmitter_maxnumberofdestinations];  // the further destinations of the fan-out mode
+    uint8_t                     destinationsnumberof;
 #if defined(USE_DEBUG_EOTRANSMITTER)    
     EOtransmitterDEBUG_t        debug;
 #endif 
@@ -129,6 +246,9 @@ struct EOtransmitter_hid
     uint16_t                    totalsizeofregulars_standard;
     uint16_t                    totalsizeofregulars_cycle0of;
     uint16_t                    totalsizeofregulars_cycle1of;
+    uint16_t                    totalsizeofregulars_scheduled;
+    uint16_t                    scheduledbytes[eo_transmitter_regrops_maxperiod];  // the bytes of the scheduled rops due in tick t are in [t % eo_transmitter_regrops_maxperiod]
+    uint16_t                    scheduledrops[eo_transmitter_regrops_maxperiod];   // and their number
     uint16_t                    maxsizeofregulars;
     uint16_t                    effectivecapacityofregulars;
     uint64_t                    txregularsprogressive;